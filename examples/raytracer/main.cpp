@@ -50,6 +50,10 @@ int main() {
                 .withPaneExtentInPixels(300)
                 .withFirstPane(focusPane = basil::HotReloadShaderPane::Builder()
                     .fromFilePath(shaderPath)
+                    .withFrozenUniform("MSAA_FACTOR")
+                    .withFrozenUniform("MAX_BOUNCES")
+                    .withFrozenUniform("SPHERE_LIMIT")
+                    .withFrozenUniform("RENDER_SHADOWS")
                     .build())
                 .withSecondPane(rt::SidePanel::Builder().build())
                 .build())
@@ -15,10 +15,16 @@ uniform vec3 cameraPosition;
 uniform vec3 lightDirection;
 uniform float lightIntensity;
 
-uniform vec3 spherePositions[64];
-uniform float sphereSizes[64];
-uniform vec3 sphereAlbedo[64];
-uniform vec3 sphereSpecular[64];
+struct Sphere {
+    vec3 position;
+    float size;
+    vec3 albedo;
+    vec3 specular;
+};
+
+layout(std430) readonly buffer Spheres {
+    Sphere spheres[];
+};
 uniform int sphereCount;
 
 uniform vec3 planeColor;
@@ -89,7 +95,7 @@ void intersectGroundPlane(Ray ray, inout RayHit bestHit) {
 }
 
 void intersectSphere(Ray ray, inout RayHit bestHit, int sphereIndex) {
-    vec4 sphere = vec4(spherePositions[sphereIndex], sphereSizes[sphereIndex]);
+    vec4 sphere = vec4(spheres[sphereIndex].position, spheres[sphereIndex].size);
 
     vec3 d = ray.origin - sphere.xyz;
     float p1 = -dot(ray.direction, d);
@@ -102,8 +108,8 @@ void intersectSphere(Ray ray, inout RayHit bestHit, int sphereIndex) {
         bestHit.distance = t;
         bestHit.position = ray.origin + t * ray.direction;
         bestHit.normal = normalize(bestHit.position - sphere.xyz);
-        bestHit.albedo = sphereAlbedo[sphereIndex];
-        bestHit.specular = sphereSpecular[sphereIndex];
+        bestHit.albedo = spheres[sphereIndex].albedo;
+        bestHit.specular = spheres[sphereIndex].specular;
     }
 }
 
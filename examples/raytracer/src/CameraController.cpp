@@ -12,20 +12,10 @@ CameraController::CameraController() : IBasilWidget({
 void CameraController::onStart() {
     lastFrameTime = FrameClock::now();
 
-    invViewID = uniformModel.addUniform(
-        std::make_shared<GLUniformPointer<float>>(
-            glm::value_ptr(inverseView),
-                "inverseView", 4, 4, 1));
-
+    invViewID = uniformModel.addUniform(inverseView, "inverseView");
     invProjID = uniformModel.addUniform(
-        std::make_shared<GLUniformPointer<float>>(
-            glm::value_ptr(inverseProjection),
-                "inverseProjection", 4, 4, 1));
-
-    positionID = uniformModel.addUniform(
-        std::make_shared<GLUniformPointer<float>>(
-            glm::value_ptr(position),
-                "cameraPosition", 3, 1, 1));
+        inverseProjection, "inverseProjection");
+    positionID = uniformModel.addUniform(position, "cameraPosition");
 
     resolutionID = uniformModel.addUniform(
         std::vector<int>({ 0, 0 }),
@@ -207,16 +197,13 @@ void CameraController::updateRotation(float deltaTime) {
 
 void CameraController::updateProjectionUniforms() {
     inverseView = camera.getInverseViewMatrix();
-    uniformModel.setUniformValue(
-        glm::value_ptr(inverseView), invViewID);
+    uniformModel.setUniformValue(inverseView, invViewID);
 
     inverseProjection = camera.getInverseProjectionMatrix();
-    uniformModel.setUniformValue(
-        glm::value_ptr(inverseProjection), invProjID);
+    uniformModel.setUniformValue(inverseProjection, invProjID);
 
     position = camera.getPosition();
-    uniformModel.setUniformValue(
-        glm::value_ptr(position), positionID);
+    uniformModel.setUniformValue(position, positionID);
 }
 
 }  // namespace basil::raytracer
@@ -125,9 +125,9 @@ class CameraController : public IBasilWidget,
     glm::mat4 inverseView = glm::mat4();
     glm::mat4 inverseProjection = glm::mat4();
 
-    unsigned int invViewID    = -1;
-    unsigned int invProjID    = -1;
-    unsigned int positionID   = -1;
+    ShaderUniformHandle<GLUniformValue<glm::mat4>> invViewID;
+    ShaderUniformHandle<GLUniformValue<glm::mat4>> invProjID;
+    ShaderUniformHandle<GLUniformValue<glm::vec3>> positionID;
     unsigned int resolutionID = -1;
 
     unsigned int callbackID = -1;
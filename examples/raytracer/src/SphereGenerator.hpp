@@ -9,6 +9,16 @@
 
 namespace basil::raytracer {
 
+/** @brief Sphere element of shader storage block, in std430 layout. */
+struct Sphere {
+    float position[3];
+    float size;
+    float albedo[3];
+    float padding0;
+    float specular[3];
+    float padding1;
+};
+
 /** @brief Widget which generates the grid of spheres and updates uniforms. */
 class SphereGenerator : public IBasilWidget,
                         public IBuildable<SphereGenerator> {
@@ -117,16 +127,10 @@ class SphereGenerator : public IBasilWidget,
 
     int sphereGridSize = 1;
 
-    unsigned int positionID = -1;
-    unsigned int sizeID     = -1;
-    unsigned int albedoID   = -1;
-    unsigned int specularID = -1;
+    unsigned int sphereID   = -1;
     unsigned int countID    = -1;
 
-    std::vector<float> positions;
-    std::vector<float> sizes;
-    std::vector<float> albedo;
-    std::vector<float> specular;
+    std::vector<Sphere> spheres;
 
     ShaderUniformModel uniforms = ShaderUniformModel();
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Data/ShaderUniformDelta.hpp"
+#include "Data/ShaderUniformHandle.hpp"
 #include "Data/ShaderUniformModel.hpp"
 #include "Data/SystemTimeModel.hpp"
 #include "Data/UserInputModel.hpp"
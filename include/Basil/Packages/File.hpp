@@ -1,5 +1,11 @@
 #pragma once
 
+#include "File/AsyncTextureLoader.hpp"
+#include "File/DecodedTextureCache.hpp"
 #include "File/FileDataLoader.hpp"
+#include "File/FileHash.hpp"
 #include "File/FileTextureSource.hpp"
+#include "File/FileWatchService.hpp"
 #include "File/ImageFileCapture.hpp"
+#include "File/MappedFile.hpp"
+#include "File/MappedTextureSource.hpp"
@@ -1,12 +1,24 @@
 #pragma once
 
+#include "OpenGL/GLPixelUploadRing.hpp"
+#include "OpenGL/GLProgramBinaryCache.hpp"
 #include "OpenGL/GLProgramUniformManager.hpp"
+#include "OpenGL/GLResourceRegistry.hpp"
+#include "OpenGL/GLScreenGeometry.hpp"
 #include "OpenGL/GLShader.hpp"
 #include "OpenGL/GLShaderPane.hpp"
+#include "OpenGL/GLShaderPermutationCache.hpp"
+#include "OpenGL/GLShaderPreprocessor.hpp"
 #include "OpenGL/GLShaderProgram.hpp"
+#include "OpenGL/GLStateCache.hpp"
 #include "OpenGL/GLTexture.hpp"
 #include "OpenGL/GLTextureFormat.hpp"
+#include "OpenGL/GLTextureUnitAllocator.hpp"
 #include "OpenGL/GLUniform.hpp"
+#include "OpenGL/GLUniformBroadcastGroup.hpp"
+#include "OpenGL/GLUniformGLM.hpp"
+#include "OpenGL/GLUniformBuffer.hpp"
+#include "OpenGL/GLUniformStorage.hpp"
 #include "OpenGL/HotReloadShaderPane.hpp"
 #include "OpenGL/ITextureSource.hpp"
 #include "OpenGL/SpanTextureSource.hpp"
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Process/EventMetrics.hpp"
+#include "Process/GLCallMetrics.hpp"
 #include "Process/IProcess.hpp"
 #include "Process/LambdaProcess.hpp"
 #include "Process/MetricsObserver.hpp"
@@ -4,5 +4,6 @@
 #include "PubSub/IDataPassThrough.hpp"
 #include "PubSub/IDataPublisher.hpp"
 #include "PubSub/IDataSubscriber.hpp"
+#include "PubSub/PubSubMetrics.hpp"
 
 
@@ -28,6 +28,13 @@ struct WidgetPrefs {
 class IBasilWidget : public IProcess,
                      public IDataPublisher,
                      public IDataSubscriber {
+ public:
+    /** @returns Process name, to identify widget in PubSub metrics */
+    std::string getPublisherName() const override {
+        return getProcessName().value_or(
+            IDataPublisher::getPublisherName());
+    }
+
 #ifdef TEST_BUILD
  public:
 #else
@@ -1,4 +1,7 @@
+#include <fmt/format.h>
+
 #include <string>
+#include <string_view>
 
 #include "BasilContext.hpp"
 
@@ -10,6 +13,7 @@ void BasilContext::initialize() {
     if (instance.isInitialized()) return;
 
     hasInitialized = true;
+    contextVersion++;
     instance.initializeGLFWContext();
     instance.initializeGLEWContext();
 
@@ -39,6 +43,9 @@ void BasilContext::initializeGLFWContext() {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, GLFW_MAJOR_VERSION);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, GLFW_MINOR_VERSION);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    #if BASIL_GL_DEBUG_OUTPUT
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+    #endif
 
     glfwWindowHint(GLFW_VISIBLE, false);
     glfwWindow = glfwCreateWindow(
@@ -59,6 +66,48 @@ void BasilContext::initializeGLEWContext() {
 
     // Save success/failure flag
     hasInitialized &= !(errorCode);
+
+    #if BASIL_GL_DEBUG_OUTPUT
+    if (hasInitialized) {
+        initializeDebugOutput();
+    }
+    #endif
+}
+
+void BasilContext::initializeDebugOutput() {
+    if (!GLEW_KHR_debug && !GLEW_VERSION_4_3) {
+        Logger::get().log(
+            fmt::format(LOG_DEBUG_UNSUPPORTED),
+            LogLevel::INFO);
+        return;
+    }
+
+    // Report on the calling thread, as the callback logs directly
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDebugMessageCallback(onDebugMessage, nullptr);
+
+    // Notifications, e.g. of buffer placement, are too frequent to log
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE,
+        GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+}
+
+void GLAPIENTRY BasilContext::onDebugMessage(
+        GLenum /* source */, GLenum /* type */, GLuint id, GLenum severity,
+        GLsizei length, const GLchar* message, const void* /* userParam */) {
+    LogLevel level = LogLevel::DEBUG;
+    switch (severity) {
+        case GL_DEBUG_SEVERITY_HIGH:    level = LogLevel::ERROR;  break;
+        case GL_DEBUG_SEVERITY_MEDIUM:  level = LogLevel::WARN;   break;
+        case GL_DEBUG_SEVERITY_LOW:     level = LogLevel::INFO;   break;
+    }
+
+    auto text = length < 0
+        ? std::string_view(message)
+        : std::string_view(message, length);
+    Logger::get().log(
+        fmt::format(LOG_DEBUG_MESSAGE, id, text),
+        level);
 }
 
 void BasilContext::logGLFWError(GLenum errorCode) {
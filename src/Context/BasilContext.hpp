@@ -35,6 +35,10 @@ class BasilContext {
     /** @return T/F if context has been initialized. */
     static bool isInitialized() { return hasInitialized; }
 
+    /** @return Number of contexts created, to detect when state cached
+     *  from a previous context no longer applies. */
+    static unsigned int getContextVersion() { return contextVersion; }
+
     /** @return Instance of Singleton context. */
     static BasilContext& get() {
         static BasilContext instance;
@@ -113,6 +117,7 @@ class BasilContext {
         = BASIL_GLFW_UNINITIALIZED_WINDOW_TITLE;
 
     inline static bool hasInitialized = false;
+    inline static unsigned int contextVersion = 0;
 
     GLFWwindow* glfwWindow = nullptr;
 
@@ -136,6 +141,7 @@ class BasilContext {
 
     void initializeGLFWContext();
     void initializeGLEWContext();
+    static void initializeDebugOutput();
 
     static void setGLFWCallbacks();
     static void onFrameBufferResize(
@@ -146,6 +152,9 @@ class BasilContext {
         GLFWwindow* window, int key, int scancode, int action, int mods);
     static void onCursorEnter(
         GLFWwindow* window, int entered);
+    static void GLAPIENTRY onDebugMessage(
+        GLenum source, GLenum type, GLuint id, GLenum severity,
+        GLsizei length, const GLchar* message, const void* userParam);
 
     static void logGLFWError(GLenum errorCode);
     static void logGLFWWindowError(const GLFWwindow* window);
@@ -153,6 +162,11 @@ class BasilContext {
 
     Logger& logger = Logger::get();
 
+    LOGGER_FORMAT LOG_DEBUG_MESSAGE =
+        "OpenGL debug output (ID{}) - {}";
+    LOGGER_FORMAT LOG_DEBUG_UNSUPPORTED =
+        "OpenGL debug output - KHR_debug not supported by driver.";
+
     // Inaccessable methods to enforce Singleton
     BasilContext() {}
     BasilContext(BasilContext const&);
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "OpenGL/GLUniform.hpp"
+
+namespace basil {
+
+/** @brief Uniforms of a ShaderUniformModel which changed between two
+ *  model versions. Published in place of the full model, so that
+ *  subscribers only upload values which have changed. */
+struct ShaderUniformDelta {
+    /** @brief ID of the model from which the delta was taken */
+    unsigned int modelID = 0;
+
+    /** @brief Model version the delta is relative to */
+    uint64_t baseVersion = 0;
+
+    /** @brief Model version after applying the delta */
+    uint64_t version = 0;
+
+    /** @brief Name of uniform block to write uniforms to,
+     *  or empty to set uniforms individually */
+    std::string blockName;
+
+    /** @brief Uniforms changed since base version */
+    std::vector<std::shared_ptr<GLUniform>> uniforms;
+
+    /** @returns Whether delta contains all uniforms of the model */
+    bool isComplete() const { return baseVersion == 0; }
+};
+
+}   // namespace basil
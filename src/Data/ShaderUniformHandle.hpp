@@ -0,0 +1,34 @@
+#pragma once
+
+#include <concepts>
+
+#include "OpenGL/GLUniform.hpp"
+
+namespace basil {
+
+/** @brief Typed reference to a uniform in a ShaderUniformModel.
+ *  Allows ShaderUniformModel::setUniformValue to write values into the
+ *  existing uniform, rather than allocating a replacement. Converts
+ *  implicitly to the uniform's ID.
+ *  @tparam U   GLUniform implementation holding the uniform's value */
+template<std::derived_from<GLUniform> U>
+class ShaderUniformHandle {
+ public:
+    /** @brief Construct invalid handle */
+    ShaderUniformHandle() = default;
+
+    /** @brief Construct handle to uniform with ID */
+    explicit ShaderUniformHandle(unsigned int uniformID)
+        : uniformID(uniformID) {}
+
+    /** @returns ID of uniform in model */
+    unsigned int getID() const { return uniformID; }
+
+    /** @returns ID of uniform in model */
+    operator unsigned int() const { return uniformID; }
+
+ private:
+    unsigned int uniformID = -1;
+};
+
+}   // namespace basil
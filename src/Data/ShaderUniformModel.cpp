@@ -1,38 +1,57 @@
 #include "ShaderUniformModel.hpp"
 
+#include <cstring>
+#include <functional>
+
 namespace basil {
 
 unsigned int ShaderUniformModel::addUniform(
         std::shared_ptr<GLUniform> uniform) {
     const std::string& name = uniform->getName();
-    if (uniformIDs.contains(name)) {
-        unsigned int ID = uniformIDs.at(name);
-        setUniform(uniform, ID);
+    if (auto existingID = findID(name)) {
+        setUniform(uniform, existingID.value());
 
-        return ID;
+        return existingID.value();
     }
 
-    uniforms.emplace(nextID, uniform);
-    uniformIDs.emplace(name, nextID);
+    unsigned int ID = slots.size();
+    slots.push_back(UniformSlot { .type = GLUniformSource<int>(nullptr) });
+    uniformNames.push_back(name);
+    uniformVersions.push_back(0);
+    uniformIsVolatile.push_back(false);
+    uniformObjects.push_back(nullptr);
+
+    insertName(ID);
+    setUniform(uniform, ID);
 
-    return nextID++;
+    return ID;
 }
 
 bool ShaderUniformModel::setUniform(
         std::shared_ptr<GLUniform> uniform, unsigned int uniformID) {
-    if (uniforms.contains(uniformID)) {
-        uniforms.at(uniformID) = uniform;
-        return true;
-    }
+    if (uniformID >= slots.size()) return false;
+
+    // Space of a previously packed value is left unused
+    UniformSlot& slot = slots[uniformID];
+    slot = UniformSlot {
+        .type = std::visit([](auto source) {
+                return GLUniformSourceGeneric(decltype(source)(nullptr));
+            }, uniform->getSource()),
+        .length = uniform->getLength(),
+        .width = uniform->getWidth(),
+        .count = uniform->getCount()
+    };
 
-    return false;
+    uniformObjects[uniformID] = uniform;
+    uniformIsVolatile[uniformID] = uniform->isVolatile();
+    markChanged(uniformID);
+    return true;
 }
 
 std::optional<std::shared_ptr<GLUniform>>
 ShaderUniformModel::getUniform(const std::string& uniformName) const {
-    if (uniformIDs.contains(uniformName)) {
-        unsigned int ID = uniformIDs.at(uniformName);
-        return std::optional(uniforms.at(ID));
+    if (auto ID = findID(uniformName)) {
+        return std::optional(getObject(ID.value()));
     }
 
     return std::nullopt;
@@ -40,11 +59,167 @@ ShaderUniformModel::getUniform(const std::string& uniformName) const {
 
 std::optional<std::shared_ptr<GLUniform>>
 ShaderUniformModel::getUniform(unsigned int uniformID) const {
-    if (uniforms.contains(uniformID)) {
-        return std::optional(uniforms.at(uniformID));
+    if (uniformID < slots.size()) {
+        return std::optional(getObject(uniformID));
+    }
+
+    return std::nullopt;
+}
+
+const std::vector<std::shared_ptr<GLUniform>>&
+ShaderUniformModel::getUniforms() const {
+    for (unsigned int ID = 0; ID < slots.size(); ID++) {
+        getObject(ID);
+    }
+
+    return uniformObjects;
+}
+
+std::optional<uint64_t>
+ShaderUniformModel::getUniformVersion(unsigned int uniformID) const {
+    if (uniformID < uniformVersions.size()) {
+        return std::optional(uniformVersions[uniformID]);
+    }
+
+    return std::nullopt;
+}
+
+ShaderUniformDelta ShaderUniformModel::getDelta(uint64_t sinceVersion) const {
+    ShaderUniformDelta delta = {
+        .modelID = modelID,
+        .baseVersion = sinceVersion,
+        .version = version,
+        .blockName = blockName
+    };
+
+    for (unsigned int ID = 0; ID < slots.size(); ID++) {
+        if (uniformVersions[ID] > sinceVersion || uniformIsVolatile[ID]) {
+            delta.uniforms.push_back(getObject(ID));
+        }
+    }
+
+    return delta;
+}
+
+unsigned int ShaderUniformModel::reserveValues(
+        GLUniformSourceGeneric type,
+        std::size_t size,
+        const std::string& name,
+        unsigned int length,
+        unsigned int width,
+        unsigned int count) {
+    std::optional<unsigned int> ID = findID(name);
+    if (!ID) {
+        ID = slots.size();
+        slots.push_back(UniformSlot { .type = type });
+        uniformNames.push_back(name);
+        uniformVersions.push_back(0);
+        uniformIsVolatile.push_back(false);
+        uniformObjects.push_back(nullptr);
+
+        insertName(ID.value());
+    }
+
+    // Reuse space of a packed value of equal size, otherwise append
+    UniformSlot& slot = slots[ID.value()];
+    std::size_t offset = slot.offset;
+    if (!slot.isPacked() || slot.size != size) {
+        offset = uniformData.size();
+        uniformData.resize(offset + size);
+    }
+
+    slot = UniformSlot {
+        .type = type,
+        .length = length,
+        .width = width,
+        .count = count,
+        .offset = offset,
+        .size = size
+    };
+
+    uniformObjects[ID.value()] = nullptr;
+    uniformIsVolatile[ID.value()] = false;
+    markChanged(ID.value());
+    return ID.value();
+}
+
+std::byte* ShaderUniformModel::getPackedValues(
+        unsigned int uniformID,
+        const GLUniformSourceGeneric& type,
+        std::size_t size,
+        bool isPartial) {
+    if (uniformID >= slots.size()) return nullptr;
+
+    const UniformSlot& slot = slots[uniformID];
+    if (!slot.isPacked() || slot.type.index() != type.index()
+            || size > slot.size || (size < slot.size && !isPartial)) {
+        return nullptr;
+    }
+
+    // Receivers keep the previous view, so it is replaced, not written
+    uniformObjects[uniformID] = nullptr;
+    return uniformData.data() + slot.offset;
+}
+
+const std::shared_ptr<GLUniform>& ShaderUniformModel::getObject(
+        unsigned int uniformID) const {
+    std::shared_ptr<GLUniform>& object = uniformObjects[uniformID];
+    const UniformSlot& slot = slots[uniformID];
+    if (object || !slot.isPacked()) return object;
+
+    object = std::visit([&](auto source) -> std::shared_ptr<GLUniform> {
+            using S = std::remove_pointer_t<decltype(source.data())>;
+            std::vector<S> values(slot.size / sizeof(S));
+            std::memcpy(values.data(),
+                uniformData.data() + slot.offset, slot.size);
+
+            return std::make_shared<GLUniformVector<S>>(std::move(values),
+                uniformNames[uniformID], slot.length, slot.width, slot.count);
+        }, slot.type);
+    return object;
+}
+
+void ShaderUniformModel::markChanged(unsigned int uniformID) {
+    uniformVersions[uniformID] = ++version;
+}
+
+std::optional<unsigned int> ShaderUniformModel::findID(
+        std::string_view name) const {
+    if (nameTable.empty()) return std::nullopt;
+
+    std::size_t mask = nameTable.size() - 1;
+    std::size_t slot = std::hash<std::string_view>()(name) & mask;
+
+    // Linear probing, table is never more than half full
+    while (nameTable[slot] != 0) {
+        unsigned int ID = nameTable[slot] - 1;
+        if (uniformNames[ID] == name) return std::optional(ID);
+
+        slot = (slot + 1) & mask;
     }
 
     return std::nullopt;
 }
 
+void ShaderUniformModel::insertName(unsigned int uniformID) {
+    if (2 * slots.size() > nameTable.size()) {
+        // Grow to next power of two, and re-insert all names
+        std::size_t capacity = nameTable.empty() ? 16 : 2 * nameTable.size();
+        nameTable.assign(capacity, 0);
+
+        for (unsigned int ID = 0; ID < uniformID; ID++) {
+            insertName(ID);
+        }
+    }
+
+    std::size_t mask = nameTable.size() - 1;
+    std::size_t slot =
+        std::hash<std::string_view>()(uniformNames[uniformID]) & mask;
+
+    while (nameTable[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    nameTable[slot] = uniformID + 1;
+}
+
 }  // namespace basil
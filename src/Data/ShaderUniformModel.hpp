@@ -1,19 +1,40 @@
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include <Basil/Packages/Builder.hpp>
 
 #include "OpenGL/GLUniform.hpp"
+#include "OpenGL/GLUniformStorage.hpp"
+
+#include "ShaderUniformDelta.hpp"
+#include "ShaderUniformHandle.hpp"
 
 namespace basil {
 
 /** @brief Data model used to maintain
- *  uniforms for GLShaderProgram objects. */
+ *  uniforms for GLShaderProgram objects.
+ *
+ *  @details Fixed-size values, i.e. scalars, arrays and values shaped by
+ *  GLUniformShape, are packed into storage owned by the model, with a
+ *  type tag and shape per uniform. GLUniform views of them are created
+ *  only when requested, e.g. for deltas, and are replaced once the value
+ *  changes. Other uniforms, such as pointers, vectors, textures and
+ *  storage blocks, are held as GLUniform objects shared with copies of
+ *  the model. Setting a value through a ShaderUniformHandle overwrites
+ *  the existing value in place. */
 class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
  public:
     /** @brief Add uniform to model
@@ -21,25 +42,36 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
      *  @returns            UID for string-less lookup */
     unsigned int addUniform(std::shared_ptr<GLUniform> uniform);
 
+    /** @brief Add uniform to model
+     *  @tparam             GLUniform implementation
+     *  @param uniform      GLUniform struct
+     *  @returns            Typed handle for string-less lookup */
+    template<std::derived_from<GLUniform> U>
+    ShaderUniformHandle<U> addUniform(std::shared_ptr<U> uniform) {
+        return ShaderUniformHandle<U>(
+            addUniform(std::static_pointer_cast<GLUniform>(uniform)));
+    }
+
     /** @brief Add scalar uniform to model
      *  @tparam             Data type of OpenGL uniform
      *  @param value        Value of uniform scalar
      *  @param name         Uniform name in shader
-     *  @returns            UID for string-less lookup */
+     *  @returns            Typed handle for string-less lookup */
     template<GLUniformType T>
-    unsigned int addUniform(
+    ShaderUniformHandle<GLUniformScalar<T>> addUniform(
             T value,
             const std::string& name) {
-        return addUniform(std::make_shared<GLUniformScalar<T>>(value, name));
+        return ShaderUniformHandle<GLUniformScalar<T>>(
+            packUniform(std::span<const T>(&value, 1), name));
     }
 
     /** @brief Add pointer uniform to model
      *  @tparam             Data type of OpenGL uniform
      *  @param value        Pointer to uniform data
      *  @param name         Uniform name in shader
-     *  @returns            UID for string-less lookup */
+     *  @returns            Typed handle for string-less lookup */
     template<GLUniformType T>
-    unsigned int addUniform(
+    ShaderUniformHandle<GLUniformPointer<T>> addUniform(
             T* value,
             const std::string& name) {
         return addUniform(std::make_shared<GLUniformPointer<T>>(value, name));
@@ -49,24 +81,108 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
      *  @tparam             Data type of OpenGL uniform
      *  @param value        Vector of uniform values
      *  @param name         Uniform name in shader
-     *  @returns            UID for string-less lookup */
+     *  @returns            Typed handle for string-less lookup */
     template<GLUniformType T>
-    unsigned int addUniform(
+    ShaderUniformHandle<GLUniformVector<T>> addUniform(
             std::vector<T> value,
             const std::string& name) {
-        return addUniform(std::make_shared<GLUniformVector<T>>(value, name));
+        return addUniform(
+            std::make_shared<GLUniformVector<T>>(std::move(value), name));
+    }
+
+    /** @brief Add fixed-size vector uniform to model, stored inline
+     *  @tparam             Data type of OpenGL uniform
+     *  @tparam N           Length of vector
+     *  @param value        Array of uniform values
+     *  @param name         Uniform name in shader
+     *  @returns            Typed handle for string-less lookup */
+    template<GLUniformType T, std::size_t N>
+    ShaderUniformHandle<GLUniformInline<T, N>> addUniform(
+            const std::array<T, N>& value,
+            const std::string& name) {
+        return ShaderUniformHandle<GLUniformInline<T, N>>(
+            packUniform(std::span<const T>(value), name, N));
+    }
+
+    /** @brief Add vector, matrix or fixed-size array uniform to model,
+     *  with shape taken from GLUniformShape, e.g. glm::mat4
+     *  @tparam V           Value type of OpenGL uniform
+     *  @param value        Value of uniform
+     *  @param name         Uniform name in shader
+     *  @returns            Typed handle for string-less lookup */
+    template<GLUniformShapedType V>
+    ShaderUniformHandle<GLUniformValue<V>> addUniform(
+            const V& value,
+            const std::string& name) {
+        using Shape = GLUniformShape<V>;
+        auto elements = getElements(value);
+        return ShaderUniformHandle<GLUniformValue<V>>(
+            packUniform(std::span<const typename Shape::Element>(elements),
+                name, Shape::Length, Shape::Width, Shape::Count));
     }
 
     /** @brief Add texture uniform to model
      *  @param value        Pointer to IGLTexture object
      *  @param name         Uniform name in shader
-     *  @returns            UID for string-less lookup */
-    unsigned int addUniform(
+     *  @returns            Typed handle for string-less lookup */
+    ShaderUniformHandle<GLUniformTexture> addUniform(
             std::shared_ptr<IGLTexture> value,
             const std::string& name) {
         return addUniform(std::make_shared<GLUniformTexture>(value, name));
     }
 
+    /** @brief Add shader storage block data to model
+     *  @tparam             Element type, matching std430 block layout
+     *  @param values       Vector of block elements
+     *  @param blockName    Storage block name in shader
+     *  @returns            Typed handle for string-less lookup */
+    template<GLStorageType T>
+    ShaderUniformHandle<GLUniformStorage> addStorageBuffer(
+            const std::vector<T>& values,
+            const std::string& blockName) {
+        return addUniform(
+            std::make_shared<GLUniformStorage>(values, blockName));
+    }
+
+    /** @brief Overwrites a range of elements in shader storage block
+     *  data, so that only the range is uploaded to receiving programs
+     *  @tparam             Element type, matching std430 block layout
+     *  @param values       Values of overwritten elements
+     *  @param uniformID    ID of storage block uniform
+     *  @param firstElement Index of first overwritten element
+     *  @returns            Whether storage block with ID was found,
+     *                      and range lies within block data */
+    template<GLStorageType T>
+    bool updateStorageBuffer(
+            std::span<const T> values,
+            unsigned int uniformID,
+            std::size_t firstElement = 0) {
+        GLUniformStorage* storage = findUniform<GLUniformStorage>(uniformID);
+        if (!storage || !storage->updateRange(values, firstElement)) {
+            return false;
+        }
+
+        markChanged(uniformID);
+        return true;
+    }
+
+    /** @brief Overwrites a range of elements in shader storage block
+     *  data, so that only the range is uploaded to receiving programs
+     *  @tparam             Element type, matching std430 block layout
+     *  @param values       Vector of overwritten elements
+     *  @param uniformID    ID of storage block uniform
+     *  @param firstElement Index of first overwritten element
+     *  @returns            Whether storage block with ID was found,
+     *                      and range lies within block data */
+    template<GLStorageType T>
+    bool updateStorageBuffer(
+            const std::vector<T>& values,
+            unsigned int uniformID,
+            std::size_t firstElement = 0) {
+        return updateStorageBuffer(
+            std::span<const T>(values), uniformID, firstElement);
+    }
+
     /** @brief Updates uniform in model
      *  @param uniform      New GLUniform
      *  @param uniformID    ID of uniform to set
@@ -81,13 +197,14 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
      *  @returns            Whether uniform with ID was found */
     template<GLUniformType T>
     bool setUniformValue(T* value, unsigned int uniformID) {
-        if (uniforms.contains(uniformID)) {
-            std::shared_ptr<GLUniform> base = uniforms.at(uniformID);
-            uniforms.at(uniformID) =
-                std::make_shared<GLUniformPointer<T>>(value, *base);
-            return true;
-        }
-        return false;
+        if (uniformID >= slots.size()) return false;
+
+        const UniformSlot& slot = slots[uniformID];
+        return setUniform(
+            std::make_shared<GLUniformPointer<T>>(value,
+                uniformNames[uniformID],
+                slot.length, slot.width, slot.count),
+            uniformID);
     }
 
     /** @brief Updates value of uniform in model to scalar value
@@ -97,13 +214,10 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
      *  @returns            Whether uniform with ID was found */
     template<GLUniformType T>
     bool setUniformValue(T value, unsigned int uniformID) {
-        if (uniforms.contains(uniformID)) {
-            std::shared_ptr<GLUniform> base = uniforms.at(uniformID);
-            uniforms.at(uniformID) =
-                std::make_shared<GLUniformScalar<T>>(value, *base);
-            return true;
-        }
-        return false;
+        if (uniformID >= slots.size()) return false;
+
+        packUniform(std::span<const T>(&value, 1), uniformNames[uniformID]);
+        return true;
     }
 
     /** @brief Updates value of uniform in model to std::vector value
@@ -113,13 +227,41 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
      *  @returns            Whether uniform with ID was found */
     template<GLUniformType T>
     bool setUniformValue(std::vector<T> value, unsigned int uniformID) {
-        if (uniforms.contains(uniformID)) {
-            std::shared_ptr<GLUniform> base = uniforms.at(uniformID);
-            uniforms.at(uniformID) =
-                std::make_shared<GLUniformVector<T>>(value, *base);
-            return true;
+        if (uniformID >= slots.size()) return false;
+
+        const UniformSlot& slot = slots[uniformID];
+        return setUniform(
+            std::make_shared<GLUniformVector<T>>(std::move(value),
+                uniformNames[uniformID], slot.length, slot.width),
+            uniformID);
+    }
+
+    /** @brief Overwrites value of uniform in place, without allocating
+     *  unless the number of values in a GLUniformVector changes
+     *  @tparam U           GLUniform implementation of uniform
+     *  @param value        New value, converted to the uniform's type
+     *  @param handle       Handle returned when adding uniform
+     *  @returns            Whether uniform with handle was found */
+    template<class U, class V>
+        requires requires(U& uniform, const V& value) {
+            uniform.setValue(value);
         }
-        return false;
+    bool setUniformValue(const V& value, ShaderUniformHandle<U> handle) {
+        unsigned int ID = handle.getID();
+        if constexpr (requires {
+                writeUniform(std::type_identity<U>(), value, ID); }) {
+            if (writeUniform(std::type_identity<U>(), value, ID)) {
+                markChanged(ID);
+                return true;
+            }
+        }
+
+        U* uniform = findUniform<U>(ID);
+        if (!uniform) return false;
+
+        uniform->setValue(value);
+        markChanged(ID);
+        return true;
     }
 
     /** @brief Updates value of uniform in model to texture location
@@ -128,26 +270,54 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
      *  @returns            Whether uniform with ID was found */
     bool setUniformValue(
             std::shared_ptr<IGLTexture> value, unsigned int uniformID) {
-        if (uniforms.contains(uniformID)) {
-            std::shared_ptr<GLUniform> base = uniforms.at(uniformID);
-            uniforms.at(uniformID) =
-                std::make_shared<GLUniformTexture>(value, *base);
-            return true;
-        }
-        return false;
+        if (uniformID >= slots.size()) return false;
+
+        return setUniform(
+            std::make_shared<GLUniformTexture>(value, uniformNames[uniformID]),
+            uniformID);
     }
 
-    /** @brief Gets value of uniform with identifier, if found */
+    /** @brief Gets value of uniform with identifier, if found. Packed
+     *  values are returned as a view, which does not observe changes. */
     std::optional<std::shared_ptr<GLUniform>> getUniform(
         const std::string& uniformName) const;
 
-    /** @brief Gets value of uniform with ID, if found */
+    /** @brief Gets value of uniform with ID, if found. Packed values
+     *  are returned as a view, which does not observe changes. */
     std::optional<std::shared_ptr<GLUniform>> getUniform(
         unsigned int uniformID) const;
 
-    /** @returns Reference to map containing all uniforms in model */
-    const std::map<unsigned int, std::shared_ptr<GLUniform>>& getUniforms()
-        const { return uniforms; }
+    /** @returns Reference to all uniforms in model, indexed by ID,
+     *  creating views of any packed values */
+    const std::vector<std::shared_ptr<GLUniform>>& getUniforms() const;
+
+    /** @brief Write uniforms in this model to the named uniform block
+     *  of receiving programs, where the block declares them. The
+     *  block's buffer is shared by all programs declaring it.
+     *  @param blockName    Name of uniform block, or empty for none */
+    void setUniformBlock(const std::string& blockName) {
+        this->blockName = blockName;
+    }
+
+    /** @returns Name of uniform block, or empty if none */
+    const std::string& getUniformBlock() const { return blockName; }
+
+    /** @returns Identifier shared by this model and any copies of it */
+    unsigned int getModelID() const { return modelID; }
+
+    /** @returns Version counter, incremented by every change to the model */
+    uint64_t getVersion() const { return version; }
+
+    /** @returns Version at which uniform with ID last changed, if found */
+    std::optional<uint64_t> getUniformVersion(unsigned int uniformID) const;
+
+    /** @brief Collects uniforms changed after a given model version.
+     *  Uniforms which reference external data, such as GLUniformPointer,
+     *  are always included, as their values may change unannounced.
+     *  @param sinceVersion Last version seen by the receiver,
+     *                      or zero to collect every uniform
+     *  @returns            Delta from sinceVersion to current version */
+    ShaderUniformDelta getDelta(uint64_t sinceVersion = 0) const;
 
     /** @brief Builder pattern for ShaderUniformModel */
     class Builder : public IBuilder<ShaderUniformModel> {
@@ -181,6 +351,23 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
             return (*this);
         }
 
+        /** @brief Adds fixed-size vector uniform to model */
+        template<GLUniformType T, std::size_t N>
+        Builder& withUniform(
+                const std::array<T, N>& value,
+                const std::string& name) {
+            this->impl->addUniform(value, name);
+            return (*this);
+        }
+
+        /** @brief Adds vector, matrix or fixed-size array uniform
+         *  to model, with shape taken from GLUniformShape */
+        template<GLUniformShapedType V>
+        Builder& withUniform(const V& value, const std::string& name) {
+            this->impl->addUniform(value, name);
+            return (*this);
+        }
+
         /** @brief Adds texture uniform to model */
         Builder& withUniform(
                 std::shared_ptr<IGLTexture> value,
@@ -188,13 +375,169 @@ class ShaderUniformModel : public IBuildable<ShaderUniformModel> {
             this->impl->addUniform(value, name);
             return (*this);
         }
+
+        /** @brief Adds shader storage block data to model */
+        template<GLStorageType T>
+        Builder& withStorageBuffer(
+                const std::vector<T>& values,
+                const std::string& blockName) {
+            this->impl->addStorageBuffer(values, blockName);
+            return (*this);
+        }
+
+        /** @brief Writes uniforms to named uniform block */
+        Builder& withUniformBlock(const std::string& blockName) {
+            this->impl->setUniformBlock(blockName);
+            return (*this);
+        }
     };
 
+#ifndef TEST_BUILD
+
  private:
-    std::map<std::string, unsigned int> uniformIDs;
-    std::map<unsigned int, std::shared_ptr<GLUniform>> uniforms;
+#endif
+    /** @brief Type tag, shape and location of the value of a uniform.
+     *  Packed values occupy size bytes of uniformData from offset. */
+    struct UniformSlot {
+        /** @brief Source with null data, whose alternative is the
+         *  element type of the uniform */
+        GLUniformSourceGeneric type;
+        unsigned int length = 1;
+        unsigned int width = 1;
+        unsigned int count = 1;
+        std::size_t offset = NOT_PACKED;
+        std::size_t size = 0;
+
+        bool isPacked() const { return offset != NOT_PACKED; }
+    };
+
+    static constexpr std::size_t NOT_PACKED = -1;
+
+    // Uniform IDs index into these parallel arrays, in order of addition
+    std::vector<UniformSlot> slots;
+    std::vector<std::string> uniformNames;
+    std::vector<uint64_t> uniformVersions;
+    std::vector<bool> uniformIsVolatile;
+
+    // Uniforms held as objects, and views of packed values, which are
+    // created on demand and dropped once the value changes
+    mutable std::vector<std::shared_ptr<GLUniform>> uniformObjects;
+
+    // Packed values of fixed-size uniforms
+    std::vector<std::byte> uniformData;
+
+    // Open-addressed table of (ID + 1), or 0 for empty slots
+    std::vector<unsigned int> nameTable;
+
+    std::string blockName;
+
+    void markChanged(unsigned int uniformID);
+
+    std::optional<unsigned int> findID(std::string_view name) const;
+    void insertName(unsigned int uniformID);
+
+    unsigned int reserveValues(
+        GLUniformSourceGeneric type,
+        std::size_t size,
+        const std::string& name,
+        unsigned int length,
+        unsigned int width,
+        unsigned int count);
+    std::byte* getPackedValues(
+        unsigned int uniformID,
+        const GLUniformSourceGeneric& type,
+        std::size_t size,
+        bool isPartial);
+    const std::shared_ptr<GLUniform>& getObject(unsigned int uniformID) const;
+
+    /** @brief Packs values into the slot of uniform with name, adding
+     *  the uniform if not found
+     *  @returns ID of uniform */
+    template<GLUniformType T>
+    unsigned int packUniform(
+            std::span<const T> values,
+            const std::string& name,
+            unsigned int length = 1,
+            unsigned int width = 1,
+            unsigned int count = 1) {
+        using S = GLUniformSourceElement<T>;
+        unsigned int ID = reserveValues(GLUniformSource<S>(nullptr),
+            values.size() * sizeof(S), name, length, width, count);
+        writeValues(ID, values);
+        return ID;
+    }
+
+    /** @brief Overwrites packed values of uniform with ID
+     *  @param isPartial    Whether to accept fewer values than packed,
+     *                      overwriting only the leading values
+     *  @returns            Whether uniform is packed with the same element
+     *                      type and number of values */
+    template<GLUniformType T>
+    bool writeValues(unsigned int uniformID,
+            std::span<const T> values, bool isPartial = false) {
+        using S = GLUniformSourceElement<T>;
+        std::byte* data = getPackedValues(uniformID,
+            GLUniformSource<S>(nullptr), values.size() * sizeof(S),
+            isPartial);
+        if (!data) return false;
+
+        for (const T& value : values) {
+            S element = static_cast<S>(value);
+            std::memcpy(data, &element, sizeof(S));
+            data += sizeof(S);
+        }
+        return true;
+    }
+
+    template<GLUniformType T, class V>
+        requires std::convertible_to<const V&, T>
+    bool writeUniform(std::type_identity<GLUniformScalar<T>>,
+            const V& value, unsigned int uniformID) {
+        T element = value;
+        return writeValues(uniformID, std::span<const T>(&element, 1));
+    }
+
+    template<GLUniformType T, unsigned int Length, unsigned int Width,
+            class V>
+        requires std::convertible_to<const V&, std::span<const T>>
+    bool writeUniform(std::type_identity<GLUniformInline<T, Length, Width>>,
+            const V& value, unsigned int uniformID) {
+        std::span<const T> values = value;
+        return writeValues(uniformID,
+            values.first(std::min<std::size_t>(values.size(), Length * Width)),
+            true);
+    }
+
+    template<GLUniformShapedType V>
+    bool writeUniform(std::type_identity<GLUniformValue<V>>,
+            const V& value, unsigned int uniformID) {
+        using Element = typename GLUniformShape<V>::Element;
+        auto elements = getElements(value);
+        return writeValues(uniformID, std::span<const Element>(elements));
+    }
+
+    /** @returns Values of shaped type, as array of its elements */
+    template<GLUniformShapedType V>
+    static auto getElements(const V& value) {
+        using Shape = GLUniformShape<V>;
+        std::array<typename Shape::Element,
+            Shape::Length * Shape::Width * Shape::Count> elements;
+        std::memcpy(elements.data(), &value, sizeof(V));
+        return elements;
+    }
+
+    template<std::derived_from<GLUniform> U>
+    U* findUniform(unsigned int uniformID) const {
+        if (uniformID >= slots.size() || slots[uniformID].isPacked()) {
+            return nullptr;
+        }
+
+        return dynamic_cast<U*>(uniformObjects[uniformID].get());
+    }
 
-    static inline unsigned int nextID = 0;
+    static inline unsigned int nextModelID = 0;
+    unsigned int modelID = nextModelID++;
+    uint64_t version = 0;
 };
 
 }   // namespace basil
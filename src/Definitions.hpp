@@ -20,6 +20,19 @@
 #endif
 
 
+// File defaults
+
+#ifndef BASIL_FILE_WATCH_DEBOUNCE_MS
+    // Time without further changes before a file change is reported
+    #define BASIL_FILE_WATCH_DEBOUNCE_MS 50
+#endif
+
+#ifndef BASIL_FILE_WATCH_POLL_MS
+    // Interval of polling, for files which inotify can not watch
+    #define BASIL_FILE_WATCH_POLL_MS 250
+#endif
+
+
 // Logging defaults
 
 #ifndef BASIL_DEFAULT_LOGGING_LEVEL
@@ -46,6 +59,59 @@
 #endif
 
 
+// OpenGL defaults
+
+#ifndef BASIL_UNIFORM_BUFFER_COUNT
+    // Number of regions cycled through by each uniform buffer
+    #define BASIL_UNIFORM_BUFFER_COUNT 3
+#endif
+
+#ifndef BASIL_GL_CALL_COUNTING
+    // Count OpenGL calls and bytes transferred, into each MetricsRecord
+    #define BASIL_GL_CALL_COUNTING 0
+#endif
+
+#ifndef BASIL_GL_DEBUG_OUTPUT
+    // Log messages of the driver, through KHR_debug
+    #ifdef DEBUG_BUILD
+        #define BASIL_GL_DEBUG_OUTPUT 1
+    #else
+        #define BASIL_GL_DEBUG_OUTPUT 0
+    #endif
+#endif
+
+#ifndef BASIL_TEXTURE_UPLOAD_BUFFER_COUNT
+    // Number of regions cycled through by streamed texture uploads
+    #define BASIL_TEXTURE_UPLOAD_BUFFER_COUNT 3
+#endif
+
+#ifndef BASIL_TEXTURE_UPLOAD_BUFFER_MAX_BYTES
+    // Largest texture upload streamed through a buffer, larger uploads
+    // are read directly from the source's memory
+    #define BASIL_TEXTURE_UPLOAD_BUFFER_MAX_BYTES (64 * 1024 * 1024)
+#endif
+
+#ifndef BASIL_TEXTURE_DECODE_THREAD_COUNT
+    // Number of threads decoding image files for AsyncTextureLoader
+    #define BASIL_TEXTURE_DECODE_THREAD_COUNT 4
+#endif
+
+#ifndef BASIL_TEXTURE_UPLOAD_BUDGET_BYTES
+    // Bytes of decoded images uploaded per frame, after the first image
+    #define BASIL_TEXTURE_UPLOAD_BUDGET_BYTES (16 * 1024 * 1024)
+#endif
+
+#ifndef BASIL_PROGRAM_BINARY_CACHE_DIRECTORY
+    // Directory of cached program binaries, or empty to disable caching
+    #define BASIL_PROGRAM_BINARY_CACHE_DIRECTORY ""
+#endif
+
+#ifndef BASIL_DECODED_TEXTURE_CACHE_DIRECTORY
+    // Directory of cached decoded images, or empty to disable caching
+    #define BASIL_DECODED_TEXTURE_CACHE_DIRECTORY ""
+#endif
+
+
 // Window defaults
 
 #ifndef BASIL_DEFAULT_WINDOW_WIDTH
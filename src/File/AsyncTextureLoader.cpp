@@ -0,0 +1,129 @@
+#include <fmt/format.h>
+
+#include <utility>
+
+#include "AsyncTextureLoader.hpp"
+
+namespace basil {
+
+AsyncTextureLoader::~AsyncTextureLoader() {
+    {
+        std::lock_guard lock(mutex);
+        isRunning = false;
+    }
+    requestAdded.notify_all();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+std::shared_ptr<GLTexture2D> AsyncTextureLoader::load(
+        const std::filesystem::path& path) {
+    if (!placeholder) {
+        placeholder = std::make_shared<
+            SpanTextureSource<unsigned char, 2, 4>>(
+                std::span(placeholderPixel));
+        placeholder->setWidth(1);
+        placeholder->setHeight(1);
+    }
+
+    auto texture = std::make_shared<GLTexture2D>();
+    texture->setSource(placeholder);
+
+    logger.log(
+        fmt::format(LOG_LOAD_QUEUED, texture->getID(), path.string()),
+        LogLevel::DEBUG);
+
+    {
+        std::lock_guard lock(mutex);
+        requests.push_back(LoadRequest { path, texture });
+
+        if (!isRunning) {
+            isRunning = true;
+            for (int i = 0; i < BASIL_TEXTURE_DECODE_THREAD_COUNT; i++) {
+                threads.emplace_back(&AsyncTextureLoader::run, this);
+            }
+        }
+    }
+    requestAdded.notify_one();
+
+    return texture;
+}
+
+void AsyncTextureLoader::run() {
+    std::unique_lock lock(mutex);
+
+    while (true) {
+        requestAdded.wait(lock, [this]() {
+            return !isRunning || !requests.empty();
+        });
+        if (!isRunning) return;
+
+        LoadRequest request = std::move(requests.front());
+        requests.pop_front();
+        decodingCount++;
+
+        // Skip files whose texture was deleted while queued
+        std::shared_ptr<ITextureSource2D> source;
+        if (!request.texture.expired()) {
+            lock.unlock();
+            source = DecodedTextureCache::get().load(request.path);
+            lock.lock();
+        }
+
+        decodingCount--;
+        decodedImages.push_back(DecodedImage {
+            request.path, request.texture, source });
+    }
+}
+
+void AsyncTextureLoader::uploadPending() {
+    std::size_t uploadedBytes = 0;
+
+    while (true) {
+        DecodedImage image;
+        {
+            std::lock_guard lock(mutex);
+            if (decodedImages.empty()) return;
+
+            auto& next = decodedImages.front();
+            std::size_t bytes = next.source && next.source->data()
+                ? next.source->format.getPixelSize()
+                    * next.source->getWidth() * next.source->getHeight()
+                : 0;
+            if (uploadedBytes > 0 && uploadedBytes + bytes > uploadBudget) {
+                return;
+            }
+
+            image = std::move(next);
+            decodedImages.pop_front();
+            uploadedBytes += bytes;
+        }
+
+        auto texture = image.texture.lock();
+        if (!texture) continue;
+
+        if (!image.source || !image.source->data()) {
+            logger.log(
+                fmt::format(LOG_LOAD_FAILURE,
+                    texture->getID(), image.path.string()),
+                LogLevel::ERROR);
+            continue;
+        }
+
+        texture->setSource(image.source);
+        logger.log(
+            fmt::format(LOG_LOAD_COMPLETE, texture->getID(),
+                image.source->getWidth(), image.source->getHeight(),
+                image.path.string()),
+            LogLevel::DEBUG);
+    }
+}
+
+std::size_t AsyncTextureLoader::getPendingCount() {
+    std::lock_guard lock(mutex);
+    return requests.size() + decodingCount + decodedImages.size();
+}
+
+}  // namespace basil
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Basil/Packages/Logging.hpp>
+
+#include "Definitions.hpp"
+
+#include "File/DecodedTextureCache.hpp"
+#include "OpenGL/GLTexture.hpp"
+
+namespace basil {
+
+/** @brief Loads image files into textures without blocking the render
+ *  thread, using Singleton pattern. Textures are returned immediately,
+ *  holding a placeholder pixel, while files are decoded by a pool of
+ *  BASIL_TEXTURE_DECODE_THREAD_COUNT threads, or read from the
+ *  DecodedTextureCache. Decoded images are uploaded by uploadPending(),
+ *  up to BASIL_TEXTURE_UPLOAD_BUDGET_BYTES per frame.
+ *
+ *  WindowView::draw calls uploadPending() each frame. Apps and tests
+ *  rendering without WindowView must call it themselves, on the thread
+ *  owning the context, or textures keep their placeholder. */
+class AsyncTextureLoader {
+ public:
+    /** @return Instance of Singleton loader. */
+    static AsyncTextureLoader& get() {
+        static AsyncTextureLoader instance;
+        return instance;
+    }
+
+    /** @brief Stops decode threads. */
+    ~AsyncTextureLoader();
+
+    /** @brief Queue image file for decoding. Starts decode threads if
+     *  not already running.
+     *  @returns Texture holding placeholder until image is uploaded
+     *  by uploadPending() */
+    std::shared_ptr<GLTexture2D> load(const std::filesystem::path& path);
+
+    /** @brief Upload decoded images to their textures, stopping once
+     *  the per-frame budget is spent. At least one image is uploaded,
+     *  however large. Must be called once per frame, on the thread
+     *  owning the context, unless drawing through WindowView. */
+    void uploadPending();
+
+    /** @returns Number of files queued which are not yet uploaded. */
+    std::size_t getPendingCount();
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    struct LoadRequest {
+        std::filesystem::path path;
+        std::weak_ptr<GLTexture2D> texture;
+    };
+
+    struct DecodedImage {
+        std::filesystem::path path;
+        std::weak_ptr<GLTexture2D> texture;
+        std::shared_ptr<ITextureSource2D> source;
+    };
+
+    AsyncTextureLoader() = default;
+
+    void run();
+
+    Logger& logger = Logger::get();
+
+    std::mutex mutex;
+    std::condition_variable requestAdded;
+    std::vector<std::thread> threads;
+    bool isRunning = false;
+
+    std::deque<LoadRequest> requests;
+    std::deque<DecodedImage> decodedImages;
+    std::size_t decodingCount = 0;
+
+    std::size_t uploadBudget = BASIL_TEXTURE_UPLOAD_BUDGET_BYTES;
+
+    // Opaque black, until image is uploaded
+    std::array<unsigned char, 4> placeholderPixel = { 0, 0, 0, 255 };
+    std::shared_ptr<SpanTextureSource<unsigned char, 2, 4>> placeholder;
+
+    LOGGER_FORMAT LOG_LOAD_QUEUED =
+        "Texture (ID{:02}) - Queued {} for loading.";
+    LOGGER_FORMAT LOG_LOAD_FAILURE =
+        "Texture (ID{:02}) - Unable to decode {}, keeping placeholder.";
+    LOGGER_FORMAT LOG_LOAD_COMPLETE =
+        "Texture (ID{:02}) - Uploaded {}x{} image from {}.";
+};
+
+}   // namespace basil
@@ -0,0 +1,163 @@
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "DecodedTextureCache.hpp"
+
+#include "File/FileHash.hpp"
+#include "File/FileTextureSource.hpp"
+
+namespace basil {
+
+DecodedTextureCache::CachedTextureSource::CachedTextureSource(
+        std::unique_ptr<MappedFile> file, int width, int height)
+        : file(std::move(file)) {
+    setWidth(width);
+    setHeight(height);
+    format = GLTextureFormat::getTextureFormat<unsigned char, 4>();
+}
+
+DecodedTextureCache::DecodedTextureCache()
+    : directory(BASIL_DECODED_TEXTURE_CACHE_DIRECTORY) {}
+
+void DecodedTextureCache::setDirectory(
+        const std::filesystem::path& setDirectory) {
+    directory = setDirectory;
+}
+
+std::shared_ptr<ITextureSource2D> DecodedTextureCache::load(
+        const std::filesystem::path& path, bool flipImageVertically) {
+    std::error_code error;
+    auto sourceTime = std::filesystem::last_write_time(path, error);
+    auto sourceSize = std::filesystem::file_size(path, error);
+
+    // Missing files are reported by FileTextureSource
+    if (!isEnabled() || error) {
+        return std::make_shared<FileTextureSource>(
+            path, flipImageVertically);
+    }
+
+    FileHeader expected;
+    expected.sourceTime = sourceTime.time_since_epoch().count();
+    expected.sourceSize = sourceSize;
+
+    auto filePath = getFilePath(path, flipImageVertically);
+    auto file = std::make_unique<MappedFile>(filePath);
+
+    FileHeader header;
+    bool isValid = file->isOpen() && file->getSize() >= sizeof(header);
+    if (isValid) {
+        std::memcpy(&header, file->getData(), sizeof(header));
+        isValid = header.magic == MAGIC
+            && header.sourceSize == expected.sourceSize
+            && header.width > 0 && header.height > 0
+            && file->getSize() == sizeof(header)
+                + PIXEL_SIZE * header.width * header.height;
+    }
+
+    // Files touched without changes, e.g. by a checkout, are still valid.
+    // Their new time is stored, so that they are not hashed again
+    if (isValid && header.sourceTime != expected.sourceTime) {
+        expected.contentHash = getContentHash(path);
+        isValid = header.contentHash == expected.contentHash;
+        if (isValid) {
+            updateSourceTime(filePath, expected.sourceTime);
+        }
+    }
+
+    if (isValid) {
+        hitCount++;
+        logger.log(fmt::format(LOG_HIT, path.string()), LogLevel::DEBUG);
+        return std::make_shared<CachedTextureSource>(
+            std::move(file), header.width, header.height);
+    }
+
+    missCount++;
+    logger.log(fmt::format(LOG_MISS, path.string()), LogLevel::DEBUG);
+
+    auto source = std::make_shared<FileTextureSource>(
+        path, flipImageVertically);
+    if (source->data()) {
+        expected.width = source->getWidth();
+        expected.height = source->getHeight();
+        if (expected.contentHash == 0) {
+            expected.contentHash = getContentHash(path);
+        }
+        save(filePath, expected, source->data());
+    }
+    return source;
+}
+
+void DecodedTextureCache::save(const std::filesystem::path& filePath,
+        const FileHeader& header, const void* pixels) {
+    // Write to temporary file first, so that a partial file is never read.
+    // Named per thread, as the same image may be decoded twice at once
+    auto tempPath = filePath;
+    tempPath += fmt::format(".{:x}.tmp",
+        std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    std::size_t pixelBytes = PIXEL_SIZE * header.width * header.height;
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    bool isWritten = file.is_open()
+        && file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+        && file.write(static_cast<const char*>(pixels), pixelBytes);
+    file.close();
+
+    if (isWritten) {
+        std::filesystem::rename(tempPath, filePath, error);
+    }
+    if (!isWritten || error) {
+        std::filesystem::remove(tempPath, error);
+        logger.log(
+            fmt::format(LOG_SAVE_FAILURE, filePath.string()),
+            LogLevel::WARN);
+    }
+}
+
+void DecodedTextureCache::updateSourceTime(
+        const std::filesystem::path& filePath, int64_t sourceTime) {
+    // Written in place, as pixels are unchanged and may be mapped
+    std::fstream file(filePath, std::ios::binary | std::ios::in
+        | std::ios::out);
+    bool isWritten = file.is_open()
+        && file.seekp(offsetof(FileHeader, sourceTime))
+        && file.write(reinterpret_cast<const char*>(&sourceTime),
+            sizeof(sourceTime));
+
+    if (!isWritten) {
+        logger.log(
+            fmt::format(LOG_SAVE_FAILURE, filePath.string()),
+            LogLevel::WARN);
+    }
+}
+
+uint64_t DecodedTextureCache::getContentHash(
+        const std::filesystem::path& path) {
+    MappedFile file(path);
+    if (!file.isOpen()) return 0;
+
+    return FileHash::hash(std::string_view(
+        reinterpret_cast<const char*>(file.getData()), file.getSize()));
+}
+
+std::filesystem::path DecodedTextureCache::getFilePath(
+        const std::filesystem::path& path, bool flipImageVertically) const {
+    std::error_code error;
+    auto absolutePath = std::filesystem::absolute(path, error);
+    uint64_t pathHash = FileHash::hash(
+        absolutePath.lexically_normal().string()
+        + (flipImageVertically ? "\nflipped" : ""));
+    return directory / fmt::format("{:016x}.rgba", pathHash);
+}
+
+}  // namespace basil
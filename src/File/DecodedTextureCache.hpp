@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include <Basil/Packages/Logging.hpp>
+
+#include "Definitions.hpp"
+
+#include "File/MappedFile.hpp"
+#include "OpenGL/ITextureSource.hpp"
+
+namespace basil {
+
+/** @brief On-disk cache of decoded image files, using Singleton pattern.
+ *  Images are stored as raw RGBA pixels, keyed by source path, and
+ *  validated by the modification time, size and content hash of the
+ *  source file. Cached images are memory-mapped, so that loading them
+ *  costs no more than copying them to the GPU. May be used from several
+ *  threads at once. Disabled unless a directory is set, e.g. through
+ *  BASIL_DECODED_TEXTURE_CACHE_DIRECTORY. */
+class DecodedTextureCache {
+ public:
+    /** @return Instance of Singleton cache. */
+    static DecodedTextureCache& get() {
+        static DecodedTextureCache instance;
+        return instance;
+    }
+
+    /** @brief Set directory of cached images, created when first
+     *  saving. An empty path disables the cache. Must not be called
+     *  while images are loading. */
+    void setDirectory(const std::filesystem::path& directory);
+
+    /** @returns Directory of cached images. */
+    const std::filesystem::path& getDirectory() const { return directory; }
+
+    /** @returns Whether a directory is set. */
+    bool isEnabled() const { return !directory.empty(); }
+
+    /** @brief Load image from cache if valid. Otherwise, decode image
+     *  file and save it to the cache.
+     *  @param flipImageVertically See FileTextureSource
+     *  @returns Source of decoded image, without data if not decoded */
+    std::shared_ptr<ITextureSource2D> load(
+        const std::filesystem::path& path,
+        bool flipImageVertically = true);
+
+    /** @returns Number of images loaded from cache. */
+    unsigned int getHitCount() const { return hitCount; }
+
+    /** @returns Number of images decoded as not found in cache. */
+    unsigned int getMissCount() const { return missCount; }
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    /** @brief Header of cache file, followed by RGBA pixels. */
+    struct FileHeader {
+        uint32_t magic = MAGIC;
+        int32_t width = 0;
+        int32_t height = 0;
+        int64_t sourceTime = 0;
+        uint64_t sourceSize = 0;
+        uint64_t contentHash = 0;
+    };
+
+    /** @brief ITextureSource reading pixels from a mapped cache file. */
+    class CachedTextureSource : public ITextureSource2D {
+     public:
+        CachedTextureSource(std::unique_ptr<MappedFile> file,
+            int width, int height);
+
+        const void* data() override {
+            return file->getData() + sizeof(FileHeader);
+        }
+
+     private:
+        std::unique_ptr<MappedFile> file;
+    };
+
+    DecodedTextureCache();
+
+    void save(const std::filesystem::path& filePath,
+        const FileHeader& header, const void* pixels);
+    void updateSourceTime(const std::filesystem::path& filePath,
+        int64_t sourceTime);
+
+    static uint64_t getContentHash(const std::filesystem::path& path);
+    std::filesystem::path getFilePath(
+        const std::filesystem::path& path, bool flipImageVertically) const;
+
+    Logger& logger = Logger::get();
+
+    std::filesystem::path directory;
+
+    std::atomic<unsigned int> hitCount = 0;
+    std::atomic<unsigned int> missCount = 0;
+
+    static constexpr uint32_t MAGIC = 0x42534C54;
+    static constexpr std::size_t PIXEL_SIZE = 4;
+
+    LOGGER_FORMAT LOG_HIT =
+        "Decoded texture cache - Loaded {} from cache.";
+    LOGGER_FORMAT LOG_MISS =
+        "Decoded texture cache - No valid image for {}, decoding.";
+    LOGGER_FORMAT LOG_SAVE_FAILURE =
+        "Decoded texture cache - Unable to write image to {}.";
+};
+
+}   // namespace basil
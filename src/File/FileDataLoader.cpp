@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "FileDataLoader.hpp"
+#include "AsyncTextureLoader.hpp"
 
 #include "OpenGL/GLTexture.hpp"
 
@@ -158,14 +159,18 @@ FileDataLoader::addUniforms(
             type = "";
         }
 
+        bool isStorage = info.contains("storage")
+            && info.at("storage").is_boolean()
+            && info.at("storage").get<bool>();
+
         if (type == TypeMap<bool>::key) {
-            model = addUniform<bool>(model, value, name);
+            model = addUniform<bool>(model, value, name, isStorage);
         } else if (type == TypeMap<unsigned int>::key) {
-            model = addUniform<unsigned int>(model, value, name);
+            model = addUniform<unsigned int>(model, value, name, isStorage);
         } else if (type == TypeMap<int>::key) {
-            model = addUniform<int>(model, value, name);
+            model = addUniform<int>(model, value, name, isStorage);
         } else {
-            model = addUniform<float>(model, value, name);
+            model = addUniform<float>(model, value, name, isStorage);
         }
     }
 
@@ -200,9 +205,8 @@ FileDataLoader::addTextures(
                 name, path.string()),
             LogLevel::DEBUG);
 
-        auto texture = GLTexture2D::Builder()
-            .fromFile(path)
-            .build();
+        // Decoded in the background, so large files do not block
+        auto texture = AsyncTextureLoader::get().load(path);
         model->addUniform(texture, name);
     }
 
@@ -27,7 +27,11 @@ class FileDataLoader {
      *  @details File reads from the "uniforms" and "textures" field.
      *  Uniforms subfields are indexed by type, then are in key value pairs
      *  with format "[uniform name]" : [value]
+     *  Uniforms with "storage" set to true are written to the shader
+     *  storage block of the same name, flattened in std430 layout.
      *  Textures are key-value pairs with format "[uniform name]" : "[file path]"
+     *  and are loaded in the background by AsyncTextureLoader, so are
+     *  only uploaded once AsyncTextureLoader::uploadPending() is called.
      *  <br><br> Example:
      *  <pre>
      *  {
@@ -46,6 +50,11 @@ class FileDataLoader {
      *              "name" : "myArray",
      *              "value" : [[1, 2], [3, 4]]
      *          },
+     *          {
+     *              "name" : "MyStorageBlock",
+     *              "value" : [0.1, 0.2, 0.3, 0.4, 0.5, 0.6],
+     *              "storage" : true
+     *          },
      *      ],
      *      "textures" : [
      *          {
@@ -125,10 +134,29 @@ class FileDataLoader {
     static std::shared_ptr<ShaderUniformModel>
     addUniform(std::shared_ptr<ShaderUniformModel> model,
             json json,
-            const std::string& name) {
+            const std::string& name,
+            bool isStorage = false) {
         const std::string_view typeKey = TypeMap<T>::key;
 
-        if (json.is_array()) {
+        if (isStorage) {
+            if (!json.is_array()) json = nlohmann::json::array({ json });
+            std::vector<T> vector = vectorFromJSONArray<T>(name, json);
+
+            // Booleans occupy four bytes in shader storage blocks
+            if constexpr (std::is_same_v<T, bool>) {
+                model->addStorageBuffer(
+                    std::vector<unsigned int>(vector.begin(), vector.end()),
+                    name);
+            } else {
+                model->addStorageBuffer(vector, name);
+            }
+
+            logger.log(
+                fmt::format(LOG_STORAGE_ADDED,
+                    typeKey, name.c_str(), vector.size()),
+                LogLevel::DEBUG);
+
+        } else if (json.is_array()) {
             // Check if uniform is in matrix format
             int vectorWidth;
             if (json.at(0).is_array()) {
@@ -221,6 +249,8 @@ class FileDataLoader {
         "Adding vector {0} with name \"{1}\" and value \"{2}\"";
     LOGGER_FORMAT LOG_SCALAR_ADDED =
         "Adding scalar {0} with name \"{1}\" and value \"{2}\"";
+    LOGGER_FORMAT LOG_STORAGE_ADDED =
+        "Adding storage block of {0} with name \"{1}\" and {2} values";
     LOGGER_FORMAT LOG_TYPE_ERROR =
         "Could not parse value \"{2}\" at key \"{1}\" as {0}";
     LOGGER_FORMAT LOG_VECTOR_TYPE_ERROR =
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace basil {
+
+/** @brief 64-bit FNV-1a hash. Unlike std::hash, values are the same in
+ *  every run and on every platform, so may name and validate files
+ *  written by one run and read by the next. */
+class FileHash {
+ public:
+    /** @brief Initial value of hash, for data of length zero. */
+    static constexpr uint64_t OFFSET_BASIS = 0xcbf29ce484222325;
+
+    /** @returns Hash of data. Pass the hash of preceding data as seed
+     *  to hash data in several parts. */
+    static constexpr uint64_t hash(std::string_view data,
+            uint64_t seed = OFFSET_BASIS) {
+        uint64_t value = seed;
+        for (char character : data) {
+            value ^= static_cast<unsigned char>(character);
+            value *= PRIME;
+        }
+        return value;
+    }
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    static constexpr uint64_t PRIME = 0x100000001b3;
+};
+
+}   // namespace basil
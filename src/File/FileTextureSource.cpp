@@ -16,8 +16,9 @@ FileTextureSource::FileTextureSource(std::filesystem::path filePath,
         return;
     }
 
-    // Flips vertically to match GLFW coordinate system
-    stbi_set_flip_vertically_on_load(shouldFlipVertically);
+    // Flips vertically to match GLFW coordinate system. Set per thread,
+    // as images may be decoded in parallel
+    stbi_set_flip_vertically_on_load_thread(shouldFlipVertically);
 
     int width, height, channels;
     const std::string pathString = filePath.string();
@@ -0,0 +1,279 @@
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "FileWatchService.hpp"
+
+namespace basil {
+
+FileWatch::~FileWatch() {
+    FileWatchService::get().unwatch(this);
+}
+
+FileWatchService::FileWatchService() {
+#ifdef __linux__
+    inotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wakeFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+
+    if (inotifyFD < 0) {
+        logger.log(fmt::format(LOG_INOTIFY_FAILURE), LogLevel::DEBUG);
+    }
+}
+
+FileWatchService::~FileWatchService() {
+    if (thread.joinable()) {
+        isRunning = false;
+        wake();
+        thread.join();
+    }
+
+#ifdef __linux__
+    if (inotifyFD >= 0) close(inotifyFD);
+    if (wakeFD >= 0) close(wakeFD);
+#endif
+}
+
+std::shared_ptr<FileWatch> FileWatchService::watch(
+        const std::filesystem::path& path) {
+    auto fileWatch = std::shared_ptr<FileWatch>(new FileWatch(path));
+    auto absolutePath = std::filesystem::absolute(path).lexically_normal();
+
+    {
+        std::lock_guard lock(mutex);
+
+        WatchedFile& file = files[absolutePath];
+        if (file.watches.empty()) {
+            file.timestamp = getTimestamp(absolutePath);
+            file.directoryWatch =
+                addDirectoryWatch(absolutePath.parent_path());
+        }
+        file.watches.push_back(fileWatch.get());
+
+        // Started under lock, so concurrent calls start one thread
+        if (!thread.joinable()) {
+            isRunning = true;
+            thread = std::thread(&FileWatchService::run, this);
+        }
+    }
+
+    // Recalculate wait time, in case file must be polled
+    wake();
+    return fileWatch;
+}
+
+void FileWatchService::unwatch(FileWatch* fileWatch) {
+    std::lock_guard lock(mutex);
+
+    for (auto it = files.begin(); it != files.end(); ++it) {
+        if (std::erase(it->second.watches, fileWatch) == 0) continue;
+
+        if (it->second.watches.empty()) {
+            files.erase(it);
+            removeUnusedDirectoryWatches();
+        }
+        return;
+    }
+}
+
+void FileWatchService::run() {
+    while (isRunning) {
+        waitForEvents();
+
+        std::lock_guard lock(mutex);
+        if (Clock::now() - lastPoll >= POLL_INTERVAL) {
+            lastPoll = Clock::now();
+            pollFiles();
+        }
+        publishSettledChanges();
+    }
+}
+
+void FileWatchService::wake() {
+#ifdef __linux__
+    if (wakeFD >= 0) {
+        uint64_t increment = 1;
+        [[maybe_unused]] auto written =
+            write(wakeFD, &increment, sizeof(increment));
+    }
+#endif
+}
+
+void FileWatchService::waitForEvents() {
+    bool hasPendingChanges = false;
+    bool hasPolledFiles = false;
+    {
+        std::lock_guard lock(mutex);
+        for (const auto& [path, file] : files) {
+            hasPendingChanges |= file.lastChange.has_value();
+            hasPolledFiles |= file.directoryWatch < 0;
+        }
+    }
+
+    // Without pending changes or polled files, sleep until woken
+    std::chrono::milliseconds timeout = std::chrono::milliseconds(-1);
+    if (hasPendingChanges) {
+        timeout = DEBOUNCE_TIME;
+    } else if (hasPolledFiles) {
+        timeout = POLL_INTERVAL;
+    }
+
+#ifdef __linux__
+    if (wakeFD >= 0) {
+        pollfd descriptors[2] = {
+            { .fd = wakeFD, .events = POLLIN, .revents = 0 },
+            { .fd = inotifyFD, .events = POLLIN, .revents = 0 }
+        };
+        nfds_t count = inotifyFD >= 0 ? 2 : 1;
+
+        if (poll(descriptors, count, timeout.count()) <= 0) return;
+
+        if (descriptors[0].revents & POLLIN) {
+            uint64_t value;
+            [[maybe_unused]] auto bytesRead =
+                read(wakeFD, &value, sizeof(value));
+        }
+        if (count > 1 && descriptors[1].revents & POLLIN) {
+            readEvents();
+        }
+        return;
+    }
+#endif
+
+    if (timeout.count() < 0 || timeout > POLL_INTERVAL) {
+        timeout = POLL_INTERVAL;
+    }
+    std::this_thread::sleep_for(timeout);
+}
+
+void FileWatchService::readEvents() {
+#ifdef __linux__
+    alignas(inotify_event) char buffer[4096];
+
+    ssize_t length;
+    while ((length = read(inotifyFD, buffer, sizeof(buffer))) > 0) {
+        std::lock_guard lock(mutex);
+
+        for (char* position = buffer; position < buffer + length;) {
+            auto event = reinterpret_cast<inotify_event*>(position);
+            position += sizeof(inotify_event) + event->len;
+
+            if (!directories.contains(event->wd)) continue;
+
+            // Directory was removed, so poll its files instead
+            if (event->mask & IN_IGNORED) {
+                for (auto& [path, file] : files) {
+                    if (file.directoryWatch != event->wd) continue;
+
+                    file.directoryWatch = -1;
+                    markChanged(file);
+                }
+                directories.erase(event->wd);
+                continue;
+            }
+
+            if (event->len == 0) continue;
+
+            auto found = files.find(directories.at(event->wd) / event->name);
+            if (found != files.end()) {
+                markChanged(found->second);
+            }
+        }
+    }
+#endif
+}
+
+void FileWatchService::pollFiles() {
+    for (auto& [path, file] : files) {
+        if (file.directoryWatch >= 0) continue;
+
+        auto timestamp = getTimestamp(path);
+        if (timestamp != file.timestamp) {
+            file.timestamp = timestamp;
+            markChanged(file);
+        }
+    }
+}
+
+void FileWatchService::publishSettledChanges() {
+    auto now = Clock::now();
+
+    for (auto& [path, file] : files) {
+        if (!file.lastChange || now - *file.lastChange < DEBOUNCE_TIME) {
+            continue;
+        }
+
+        file.lastChange.reset();
+        for (FileWatch* fileWatch : file.watches) {
+            fileWatch->changed = true;
+        }
+    }
+}
+
+void FileWatchService::markChanged(WatchedFile& file) {
+    file.lastChange = Clock::now();
+}
+
+int FileWatchService::addDirectoryWatch(
+        const std::filesystem::path& directory) {
+#ifdef __linux__
+    if (inotifyFD < 0) return -1;
+
+    // Watch directory rather than file, as editors often save
+    // by writing a new file and renaming it over the old one
+    int watchDescriptor = inotify_add_watch(inotifyFD, directory.c_str(),
+        IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE
+        | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+
+    if (watchDescriptor < 0) {
+        logger.log(
+            fmt::format(LOG_DIRECTORY_FAILURE, directory.string()),
+            LogLevel::DEBUG);
+        return -1;
+    }
+
+    directories[watchDescriptor] = directory;
+    return watchDescriptor;
+#else
+    (void) directory;
+    return -1;
+#endif
+}
+
+void FileWatchService::removeUnusedDirectoryWatches() {
+    for (auto it = directories.begin(); it != directories.end();) {
+        bool isUsed = std::any_of(files.begin(), files.end(),
+            [&](const auto& entry) {
+                return entry.second.directoryWatch == it->first;
+            });
+
+        if (isUsed) {
+            ++it;
+            continue;
+        }
+
+#ifdef __linux__
+        inotify_rm_watch(inotifyFD, it->first);
+#endif
+        it = directories.erase(it);
+    }
+}
+
+std::optional<std::filesystem::file_time_type>
+FileWatchService::getTimestamp(const std::filesystem::path& path) {
+    std::error_code error;
+    auto timestamp = std::filesystem::last_write_time(path, error);
+    if (error) return std::nullopt;
+
+    return timestamp;
+}
+
+}  // namespace basil
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <Basil/Packages/Logging.hpp>
+
+#include "Definitions.hpp"
+
+namespace basil {
+
+/** @brief Handle to a file watched by FileWatchService. The file stays
+ *  watched for as long as the handle exists. */
+class FileWatch {
+ public:
+    /** @brief Stops watching file. */
+    ~FileWatch();
+
+    FileWatch(const FileWatch&) = delete;
+    FileWatch& operator=(const FileWatch&) = delete;
+
+    /** @returns Path of watched file. */
+    const std::filesystem::path& getPath() const { return path; }
+
+    /** @returns Whether file has been modified, created or removed since
+     *  the last call. Also true on the first call, so that the file is
+     *  loaded initially. Does not access the file system. */
+    bool hasChanged() { return changed.exchange(false); }
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    friend class FileWatchService;
+    explicit FileWatch(const std::filesystem::path& path) : path(path) {}
+
+    std::filesystem::path path;
+    std::atomic<bool> changed = true;
+};
+
+/** @brief Watches files for changes on a background thread, using
+ *  Singleton pattern. Uses inotify on the directories of watched files
+ *  where available, so idle files cost nothing, and polls modification
+ *  times otherwise. Bursts of changes, e.g. an editor writing a file in
+ *  several steps, are reported once no change has happened for
+ *  BASIL_FILE_WATCH_DEBOUNCE_MS. */
+class FileWatchService {
+ public:
+    /** @return Instance of Singleton service. */
+    static FileWatchService& get() {
+        static FileWatchService instance;
+        return instance;
+    }
+
+    /** @brief Stops background thread. */
+    ~FileWatchService();
+
+    /** @brief Start watching file at path, which need not exist yet.
+     *  Starts background thread if not already running.
+     *  @returns Handle which reports changes until destroyed */
+    std::shared_ptr<FileWatch> watch(const std::filesystem::path& path);
+
+    /** @returns Whether changes are reported by inotify, rather than
+     *  by polling modification times. */
+    bool isUsingInotify() const { return inotifyFD >= 0; }
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    friend class FileWatch;
+    using Clock = std::chrono::steady_clock;
+
+    struct WatchedFile {
+        std::vector<FileWatch*> watches;
+        std::optional<std::filesystem::file_time_type> timestamp;
+        std::optional<Clock::time_point> lastChange;
+        int directoryWatch = -1;
+    };
+
+    FileWatchService();
+
+    void unwatch(FileWatch* fileWatch);
+
+    void run();
+    void wake();
+    void waitForEvents();
+    void readEvents();
+    void pollFiles();
+    void publishSettledChanges();
+    void markChanged(WatchedFile& file);
+
+    int addDirectoryWatch(const std::filesystem::path& directory);
+    void removeUnusedDirectoryWatches();
+
+    static std::optional<std::filesystem::file_time_type>
+    getTimestamp(const std::filesystem::path& path);
+
+    Logger& logger = Logger::get();
+
+    std::mutex mutex;
+    std::thread thread;
+    std::atomic<bool> isRunning = false;
+
+    std::map<std::filesystem::path, WatchedFile> files;
+    std::map<int, std::filesystem::path> directories;
+
+    int inotifyFD = -1;
+    int wakeFD = -1;
+    Clock::time_point lastPoll;
+
+    static constexpr auto DEBOUNCE_TIME =
+        std::chrono::milliseconds(BASIL_FILE_WATCH_DEBOUNCE_MS);
+    static constexpr auto POLL_INTERVAL =
+        std::chrono::milliseconds(BASIL_FILE_WATCH_POLL_MS);
+
+    LOGGER_FORMAT LOG_INOTIFY_FAILURE =
+        "File watch - inotify unavailable, polling files instead.";
+    LOGGER_FORMAT LOG_DIRECTORY_FAILURE =
+        "File watch - Unable to watch directory {}, polling instead.";
+};
+
+}   // namespace basil
@@ -10,6 +10,9 @@
 
 #include <string>
 
+#include "OpenGL/GLStateCache.hpp"
+#include "Process/GLCallMetrics.hpp"
+
 namespace basil {
 
 ImageFileCapture::ImageFileCapture() {
@@ -21,6 +24,7 @@ ImageFileCapture::ImageFileCapture() {
 
 ImageFileCapture::~ImageFileCapture() {
     glDeleteBuffers(1, &pixelBufferID);
+    GLStateCache::get().releaseBuffer(pixelBufferID);
     logger.log(
         fmt::format(LOG_BUFFER_DELETED, pixelBufferID),
         LogLevel::DEBUG);
@@ -31,14 +35,15 @@ void ImageFileCapture::updateBufferSize(int newWidth, int newHeight) {
     height = newHeight;
     int bytes = 3 * width * height;
 
-    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBufferID);
+    auto& stateCache = GLStateCache::get();
+    stateCache.bindPixelBuffer(GL_PIXEL_PACK_BUFFER, pixelBufferID);
     glBufferData(GL_PIXEL_PACK_BUFFER, bytes, NULL, GL_STREAM_READ);
-    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    stateCache.bindPixelBuffer(GL_PIXEL_PACK_BUFFER, 0);
 }
 
 void ImageFileCapture::clearBuffer() {
     glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
-    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    GLStateCache::get().bindPixelBuffer(GL_PIXEL_PACK_BUFFER, 0);
 }
 
 bool ImageFileCapture::capture(
@@ -95,10 +100,12 @@ std::future<bool> ImageFileCapture::captureAsync(
 
 GLubyte* ImageFileCapture::copyFrameToBuffer(ViewArea area) {
     glReadBuffer(GL_BACK);
-    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBufferID);
+    GLStateCache::get().bindPixelBuffer(GL_PIXEL_PACK_BUFFER, pixelBufferID);
     glReadPixels(
         area.xOffset, area.yOffset, area.width, area.height,
         GL_RGB, GL_UNSIGNED_BYTE, 0);
+    BASIL_COUNT_GL_CALL(GLCallType::READBACK,
+        3 * area.width * area.height);
 
     GLubyte* pixelDataPointer = static_cast<GLubyte*>(
         glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
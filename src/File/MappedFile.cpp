@@ -0,0 +1,82 @@
+#include <fstream>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.hpp"
+
+namespace basil {
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+#ifdef __linux__
+    int fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0) return;
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0) {
+        void* mapping = mmap(nullptr, fileStatus.st_size,
+            PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping != MAP_FAILED) {
+            data = static_cast<const std::byte*>(mapping);
+            size = fileStatus.st_size;
+            isMapped = true;
+        }
+    }
+
+    // Mapping stays valid once the file is closed
+    close(fileDescriptor);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open() || file.tellg() <= 0) return;
+
+    fileContents.resize(file.tellg());
+    file.seekg(0);
+    if (file.read(reinterpret_cast<char*>(fileContents.data()),
+            fileContents.size())) {
+        data = fileContents.data();
+        size = fileContents.size();
+    }
+#endif
+}
+
+void MappedFile::advise(Access access,
+        std::size_t offset, std::size_t length) {
+#ifdef __linux__
+    if (!isMapped || offset >= size) return;
+
+    // Range must start on a page boundary
+    std::size_t pageSize = sysconf(_SC_PAGESIZE);
+    std::size_t start = offset - offset % pageSize;
+    std::size_t end = (length == 0 || offset + length > size)
+        ? size : offset + length;
+
+    int advice = MADV_NORMAL;
+    switch (access) {
+        case Access::SEQUENTIAL:    advice = MADV_SEQUENTIAL; break;
+        case Access::RANDOM:        advice = MADV_RANDOM; break;
+        case Access::WILL_NEED:     advice = MADV_WILLNEED; break;
+        case Access::DONT_NEED:     advice = MADV_DONTNEED; break;
+        default:                    break;
+    }
+
+    madvise(const_cast<std::byte*>(data) + start, end - start, advice);
+#else
+    (void) access;
+    (void) offset;
+    (void) length;
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef __linux__
+    if (isMapped) {
+        munmap(const_cast<std::byte*>(data), size);
+    }
+#endif
+}
+
+}  // namespace basil
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace basil {
+
+/** @brief Read-only view of a file in memory. Uses mmap where
+ *  available, so pages are only read once accessed, and are shared
+ *  with the page cache rather than copied. Otherwise, the file is
+ *  read into memory. */
+class MappedFile {
+ public:
+    /** @brief Expected pattern of access, see madvise. */
+    enum class Access {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILL_NEED,
+        DONT_NEED
+    };
+
+    /** @brief Map file at path. Check isOpen() for success. */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    /** @brief Unmap file. */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** @returns Whether file was mapped. Empty files are not. */
+    bool isOpen() const { return data != nullptr; }
+
+    /** @returns Pointer to contents of file. */
+    const std::byte* getData() const { return data; }
+
+    /** @returns Size of file, in bytes. */
+    std::size_t getSize() const { return size; }
+
+    /** @brief Hint how a range of the file will be accessed, e.g. to
+     *  start reading ahead, or to drop pages no longer needed. Ignored
+     *  where mmap is unavailable.
+     *  @param offset   Start of range, in bytes
+     *  @param length   Length of range, or 0 for the rest of the file */
+    void advise(Access access,
+        std::size_t offset = 0, std::size_t length = 0);
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    const std::byte* data = nullptr;
+    std::size_t size = 0;
+    bool isMapped = false;
+    std::vector<std::byte> fileContents;
+};
+
+}   // namespace basil
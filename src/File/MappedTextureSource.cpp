@@ -0,0 +1,105 @@
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+
+#include "MappedTextureSource.hpp"
+
+namespace basil {
+
+template class MappedTextureSource<1>;
+template class MappedTextureSource<2>;
+template class MappedTextureSource<3>;
+
+template<int N>
+MappedTextureSource<N>::MappedTextureSource(
+        const std::filesystem::path& filePath)
+        : file(std::make_unique<MappedFile>(filePath)) {
+    MappedTextureHeader header;
+    if (!file->isOpen() || file->getSize() < sizeof(header)) {
+        logger.log(
+            fmt::format(LOG_FILE_MISSING, filePath.string()),
+            LogLevel::ERROR);
+        return;
+    }
+    std::memcpy(&header, file->getData(), sizeof(header));
+
+    std::optional<GLTextureFormat> format =
+        GLTextureFormat::getTextureFormat(header.type, header.channels);
+    std::size_t dataSize = format ? format->getPixelSize() : 0;
+
+    // Sizes are untrusted, so must not wrap past the size of the file
+    for (int i = 0; i < N; i++) {
+        std::size_t factor = std::max(header.size[i], 0);
+        if (factor == 0 || dataSize > SIZE_MAX / factor) {
+            dataSize = 0;
+            break;
+        }
+        dataSize *= factor;
+    }
+
+    if (header.magic != MappedTextureHeader::MAGIC
+            || header.dimensionCount != N
+            || dataSize == 0
+            || file->getSize() - sizeof(header) < dataSize) {
+        logger.log(
+            fmt::format(LOG_INVALID_HEADER, filePath.string(), N),
+            LogLevel::ERROR);
+        return;
+    }
+
+    for (int i = 0; i < N; i++) {
+        this->dimension[i] = header.size[i];
+    }
+    this->format = format.value();
+    mappedData = file->getData() + sizeof(header);
+
+    // Data is read once, in order, when first uploaded
+    file->advise(MappedFile::Access::SEQUENTIAL, sizeof(header), dataSize);
+    file->advise(MappedFile::Access::WILL_NEED, sizeof(header), dataSize);
+}
+
+template<int N>
+const void* MappedTextureSource<N>::data() {
+    return mappedData;
+}
+
+template<int N>
+bool MappedTextureSource<N>::save(const std::filesystem::path& filePath,
+        ITextureSource<N>& source) {
+    const void* sourceData = source.data();
+    std::optional<GLTextureFormat> channelFormat =
+        GLTextureFormat::getTextureFormat(source.format.type, 1);
+    if (!sourceData || !channelFormat) return false;
+
+    MappedTextureHeader header;
+    header.dimensionCount = N;
+    header.type = source.format.type;
+    header.channels = source.format.getPixelSize()
+        / channelFormat->getPixelSize();
+
+    std::size_t dataSize = source.format.getPixelSize();
+    header.size[0] = source.getWidth();
+    if constexpr (N > 1) header.size[1] = source.getHeight();
+    if constexpr (N > 2) header.size[2] = source.getDepth();
+    for (int i = 0; i < N; i++) {
+        dataSize *= std::max(header.size[i], 0);
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    return file.is_open()
+        && file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+        && file.write(static_cast<const char*>(sourceData), dataSize);
+}
+
+template<int N>
+typename MappedTextureSource<N>::Builder&
+MappedTextureSource<N>::Builder::fromFilePath(
+        const std::filesystem::path& filePath) {
+    this->impl = std::make_unique<MappedTextureSource<N>>(filePath);
+    return (*this);
+}
+
+}  // namespace basil
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include <Basil/Packages/Logging.hpp>
+
+#include "Builder/IBuildable.hpp"
+#include "Builder/IBuilder.hpp"
+#include "File/MappedFile.hpp"
+#include "OpenGL/ITextureSource.hpp"
+
+namespace basil {
+
+/** @brief Header of raw texture file, followed by tightly packed data,
+ *  in rows of width, then height, then depth. */
+struct MappedTextureHeader {
+    /** @brief Identifies file as raw texture. */
+    uint32_t magic = MAGIC;
+
+    /** @brief Dimensionality of texture, i.e. 1, 2, or 3. */
+    uint32_t dimensionCount = 0;
+
+    /** @brief Width, height and depth, in pixels. Unused dimensions
+     *  are 1. */
+    int32_t size[3] = { 1, 1, 1 };
+
+    /** @brief Numeric type of data, i.e. GL_FLOAT */
+    uint32_t type = 0;
+
+    /** @brief Number of channels, from 1 to 4. */
+    uint32_t channels = 0;
+
+    /** @brief Unused, so that data is aligned to 8 bytes. */
+    uint32_t reserved = 0;
+
+    static constexpr uint32_t MAGIC = 0x42534C52;
+};
+
+/** @brief ITextureSource implementation which memory-maps a raw texture
+ *  file, so that data is uploaded straight from the page cache, without
+ *  first being read into a heap buffer. Pages are read ahead as soon as
+ *  the file is mapped.
+ *
+ *  @tparam N Dimensionality of texture, i.e. 1D, 2D, or 3D.
+ */
+template<int N>
+class MappedTextureSource : public ITextureSource<N>,
+                            public IBuildable<MappedTextureSource<N>> {
+ public:
+    /** @brief Default initializer. */
+    MappedTextureSource() = default;
+
+    /** @brief Maps raw texture file at path. */
+    explicit MappedTextureSource(const std::filesystem::path& filePath);
+
+    /** @returns Pointer to mapped data, or nullptr if not mapped. */
+    const void* data() override;
+
+    /** @brief Write data of source to raw texture file, e.g. to convert
+     *  it once for later mapping.
+     *  @returns Whether file was written */
+    static bool save(const std::filesystem::path& filePath,
+        ITextureSource<N>& source);
+
+    class Builder : public IBuilder<MappedTextureSource<N>> {
+     public:
+        /** @brief Create texture source from raw texture file. */
+        Builder& fromFilePath(const std::filesystem::path& filePath);
+    };
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    std::unique_ptr<MappedFile> file;
+    const void* mappedData = nullptr;
+
+    Logger& logger = Logger::get();
+
+    LOGGER_FORMAT LOG_FILE_MISSING =
+        "Mapped texture - Unable to map file {}.";
+    LOGGER_FORMAT LOG_INVALID_HEADER =
+        "Mapped texture - File {} is not a valid {}D raw texture.";
+};
+
+using MappedTextureSource1D = MappedTextureSource<1>;
+using MappedTextureSource2D = MappedTextureSource<2>;
+using MappedTextureSource3D = MappedTextureSource<3>;
+
+}   // namespace basil
@@ -0,0 +1,68 @@
+#include <cstring>
+
+#include "GLPixelUploadRing.hpp"
+#include "GLStateCache.hpp"
+
+namespace basil {
+
+GLPixelUploadRing::GLPixelUploadRing(std::size_t regionSize)
+        : regionSize(align(regionSize)),
+          fences(BASIL_TEXTURE_UPLOAD_BUFFER_COUNT, nullptr) {
+    std::size_t totalSize = this->regionSize * fences.size();
+    GLbitfield flags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glCreateBuffers(1, &bufferID);
+    glNamedBufferStorage(bufferID, totalSize, nullptr, flags);
+    mappedData = static_cast<std::byte*>(
+        glMapNamedBufferRange(bufferID, 0, totalSize, flags));
+}
+
+GLPixelUploadRing::~GLPixelUploadRing() {
+    for (GLsync& fence : fences) {
+        if (fence) {
+            glDeleteSync(fence);
+        }
+    }
+
+    glUnmapNamedBuffer(bufferID);
+    glDeleteBuffers(1, &bufferID);
+    GLStateCache::get().releaseBuffer(bufferID);
+}
+
+std::byte* GLPixelUploadRing::acquire() {
+    currentRegion = (currentRegion + 1) % fences.size();
+
+    // Wait for GPU to finish reading from the next region
+    GLsync& fence = fences.at(currentRegion);
+    if (fence) {
+        GLenum result;
+        do {
+            result = glClientWaitSync(
+                fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+        } while (result == GL_TIMEOUT_EXPIRED);
+
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    return mappedData ? mappedData + getOffset() : nullptr;
+}
+
+std::size_t GLPixelUploadRing::write(const void* data, std::size_t size) {
+    std::byte* region = acquire();
+    if (region) {
+        std::memcpy(region, data, size);
+    }
+    return getOffset();
+}
+
+void GLPixelUploadRing::fence() {
+    GLsync& fence = fences.at(currentRegion);
+    if (fence) {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+}  // namespace basil
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <Basil/Packages/Context.hpp>
+
+#include "Definitions.hpp"
+
+namespace basil {
+
+/** @brief Persistently mapped, multi-buffered pixel unpack buffer, for
+ *  streaming texture uploads. Each upload is copied into the next
+ *  region, and is guarded by a fence until the GPU has read it, so
+ *  that the CPU fills one region while earlier ones are uploaded. */
+class GLPixelUploadRing : private IBasilContextConsumer {
+ public:
+    /** @brief Create and map buffer of BASIL_TEXTURE_UPLOAD_BUFFER_COUNT
+     *  regions, each holding regionSize bytes. */
+    explicit GLPixelUploadRing(std::size_t regionSize);
+
+    /** @brief Unmap and delete buffer. */
+    ~GLPixelUploadRing();
+
+    GLPixelUploadRing(const GLPixelUploadRing&) = delete;
+    GLPixelUploadRing& operator=(const GLPixelUploadRing&) = delete;
+
+    /** @brief Make the next region current, first waiting for the GPU
+     *  only if that region is still being read.
+     *  @returns Pointer to mapped region, or nullptr if mapping failed */
+    std::byte* acquire();
+
+    /** @brief Copy data into the next region, see acquire.
+     *  @returns Byte offset of region, to pass to glTexSubImage */
+    std::size_t write(const void* data, std::size_t size);
+
+    /** @brief Guard the region last written until commands issued
+     *  so far, i.e. its upload, have completed. */
+    void fence();
+
+    /** @returns OpenGL ID of buffer. */
+    GLuint getID() const { return bufferID; }
+
+    /** @returns Size of each region, in bytes. */
+    std::size_t getRegionSize() const { return regionSize; }
+
+    /** @returns Byte offset of current region within buffer. */
+    std::size_t getOffset() const { return currentRegion * regionSize; }
+
+    /** @returns Size rounded up to ALIGNMENT. */
+    static std::size_t align(std::size_t size) {
+        return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    /** @brief Alignment of regions, and of data packed within them, as
+     *  unpack offsets must be multiples of the size of the pixel type. */
+    static constexpr std::size_t ALIGNMENT = 16;
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    GLuint bufferID = 0;
+    std::byte* mappedData = nullptr;
+    std::size_t regionSize = 0;
+    unsigned int currentRegion = 0;
+    std::vector<GLsync> fences;
+};
+
+}   // namespace basil
@@ -0,0 +1,171 @@
+#include <fmt/format.h>
+
+#include <chrono>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+#include "GLProgramBinaryCache.hpp"
+
+#include "File/FileHash.hpp"
+
+namespace basil {
+
+GLProgramBinaryCache::GLProgramBinaryCache()
+    : directory(BASIL_PROGRAM_BINARY_CACHE_DIRECTORY) {}
+
+void GLProgramBinaryCache::setDirectory(
+        const std::filesystem::path& setDirectory) {
+    directory = setDirectory;
+}
+
+bool GLProgramBinaryCache::isEnabled() {
+    if (directory.empty()) return false;
+
+    if (!isSupported.has_value()) {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        isSupported = formatCount > 0;
+
+        if (!isSupported.value()) {
+            logger.log(fmt::format(LOG_UNSUPPORTED), LogLevel::INFO);
+        }
+    }
+    return isSupported.value();
+}
+
+bool GLProgramBinaryCache::load(GLuint programID,
+        const std::string& vertexCode,
+        const std::string& fragmentCode) {
+    auto startTime = FrameClock::now();
+    uint64_t sourceHash = getSourceHash(vertexCode, fragmentCode);
+    auto filePath = getFilePath(sourceHash);
+
+    std::ifstream file(filePath, std::ios::binary);
+    FileHeader header;
+    std::string fileDriver;
+    std::vector<char> binary;
+
+    bool isValid = file.is_open()
+        && file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        && header.magic == MAGIC
+        && header.sourceHash == sourceHash
+        && header.driverLength == getDriver().size();
+
+    if (isValid) {
+        fileDriver.resize(header.driverLength);
+        binary.resize(header.binaryLength);
+        isValid = file.read(fileDriver.data(), fileDriver.size())
+            && file.read(binary.data(), binary.size())
+            && fileDriver == getDriver();
+    }
+
+    if (!isValid) {
+        missCount++;
+        logger.log(fmt::format(LOG_MISS, programID), LogLevel::INFO);
+        return false;
+    }
+
+    glProgramBinary(programID, header.binaryFormat,
+        binary.data(), binary.size());
+
+    // Driver may reject binaries, e.g. after an update
+    GLint success = GL_FALSE;
+    glGetProgramiv(programID, GL_LINK_STATUS, &success);
+    if (!success) {
+        missCount++;
+        logger.log(
+            fmt::format(LOG_REJECTED, filePath.string()),
+            LogLevel::INFO);
+        return false;
+    }
+
+    hitCount++;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    auto loadTime = Milliseconds(FrameClock::now() - startTime);
+    auto linkTime = Milliseconds(
+        std::chrono::nanoseconds(header.linkTimeNanoseconds));
+    logger.log(
+        fmt::format(LOG_HIT, programID,
+            loadTime.count(), linkTime.count() - loadTime.count()),
+        LogLevel::INFO);
+    return true;
+}
+
+void GLProgramBinaryCache::save(GLuint programID,
+        const std::string& vertexCode,
+        const std::string& fragmentCode,
+        FrameClock::duration linkTime) {
+    GLint binaryLength = 0;
+    glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0) return;
+
+    FileHeader header;
+    std::vector<char> binary(binaryLength);
+    GLenum binaryFormat = 0;
+    glGetProgramBinary(programID, binaryLength, NULL,
+        &binaryFormat, binary.data());
+
+    header.binaryFormat = binaryFormat;
+    header.sourceHash = getSourceHash(vertexCode, fragmentCode);
+    header.linkTimeNanoseconds = std::chrono::duration_cast<
+        std::chrono::nanoseconds>(linkTime).count();
+    header.driverLength = getDriver().size();
+    header.binaryLength = binary.size();
+
+    // Write to temporary file first, so that a partial file is never read
+    auto filePath = getFilePath(header.sourceHash);
+    auto tempPath = filePath;
+    tempPath += ".tmp";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    bool isWritten = file.is_open()
+        && file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+        && file.write(getDriver().data(), getDriver().size())
+        && file.write(binary.data(), binary.size());
+    file.close();
+
+    if (isWritten) {
+        std::filesystem::rename(tempPath, filePath, error);
+    }
+    if (!isWritten || error) {
+        std::filesystem::remove(tempPath, error);
+        logger.log(
+            fmt::format(LOG_SAVE_FAILURE, filePath.string()),
+            LogLevel::WARN);
+    }
+}
+
+const std::string& GLProgramBinaryCache::getDriver() {
+    if (!driver.has_value()) {
+        auto getString = [](GLenum name) -> std::string {
+            auto value = reinterpret_cast<const char*>(glGetString(name));
+            return value ? value : "";
+        };
+        driver = getString(GL_VENDOR) + "\n"
+            + getString(GL_RENDERER) + "\n"
+            + getString(GL_VERSION);
+    }
+    return driver.value();
+}
+
+uint64_t GLProgramBinaryCache::getSourceHash(
+        const std::string& vertexCode,
+        const std::string& fragmentCode) {
+    // Separated by null characters, so that code cannot shift between parts
+    uint64_t hash = FileHash::hash(vertexCode);
+    hash = FileHash::hash(std::string_view("\0", 1), hash);
+    hash = FileHash::hash(fragmentCode, hash);
+    hash = FileHash::hash(std::string_view("\0", 1), hash);
+    return FileHash::hash(getDriver(), hash);
+}
+
+std::filesystem::path GLProgramBinaryCache::getFilePath(
+        uint64_t sourceHash) const {
+    return directory / fmt::format("{:016x}.bin", sourceHash);
+}
+
+}  // namespace basil
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include <Basil/Packages/Chrono.hpp>
+#include <Basil/Packages/Logging.hpp>
+
+#include "Definitions.hpp"
+
+namespace basil {
+
+/** @brief On-disk cache of linked program binaries, using Singleton
+ *  pattern. Binaries are keyed by the vertex and fragment code, which
+ *  includes any injected defines, and by the OpenGL vendor, renderer and
+ *  version, so that a driver update invalidates the cache. Disabled
+ *  unless a directory is set, e.g. through
+ *  BASIL_PROGRAM_BINARY_CACHE_DIRECTORY. */
+class GLProgramBinaryCache {
+ public:
+    /** @return Instance of Singleton cache. */
+    static GLProgramBinaryCache& get() {
+        static GLProgramBinaryCache instance;
+        return instance;
+    }
+
+    /** @brief Set directory of cached binaries, created when first
+     *  saving. An empty path disables the cache. */
+    void setDirectory(const std::filesystem::path& directory);
+
+    /** @returns Directory of cached binaries. */
+    const std::filesystem::path& getDirectory() const { return directory; }
+
+    /** @returns Whether a directory is set, and the driver supports
+     *  at least one program binary format. */
+    bool isEnabled();
+
+    /** @brief Link program from cached binary, if any. The binary is
+     *  validated by the driver, and ignored if rejected.
+     *  @returns Whether program was linked from cached binary */
+    bool load(GLuint programID,
+        const std::string& vertexCode,
+        const std::string& fragmentCode);
+
+    /** @brief Save binary of successfully linked program.
+     *  @param linkTime Time taken to link, as saved by later loads */
+    void save(GLuint programID,
+        const std::string& vertexCode,
+        const std::string& fragmentCode,
+        FrameClock::duration linkTime);
+
+    /** @returns Number of programs loaded from cache. */
+    unsigned int getHitCount() const { return hitCount; }
+
+    /** @returns Number of programs linked as not found in cache. */
+    unsigned int getMissCount() const { return missCount; }
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    /** @brief Header of cache file, followed by driver string and
+     *  program binary. */
+    struct FileHeader {
+        uint32_t magic = MAGIC;
+        uint32_t binaryFormat = 0;
+        uint64_t sourceHash = 0;
+        uint64_t linkTimeNanoseconds = 0;
+        uint32_t driverLength = 0;
+        uint32_t binaryLength = 0;
+    };
+
+    GLProgramBinaryCache();
+
+    const std::string& getDriver();
+    uint64_t getSourceHash(
+        const std::string& vertexCode,
+        const std::string& fragmentCode);
+    std::filesystem::path getFilePath(uint64_t sourceHash) const;
+
+    Logger& logger = Logger::get();
+
+    std::filesystem::path directory;
+    std::optional<std::string> driver;
+    std::optional<bool> isSupported;
+
+    unsigned int hitCount = 0;
+    unsigned int missCount = 0;
+
+    static constexpr uint32_t MAGIC = 0x42534C50;
+
+    LOGGER_FORMAT LOG_HIT =
+        "Program binary cache - Loaded program (ID{:02}) in {:.2f} ms, "
+        "saving {:.2f} ms.";
+    LOGGER_FORMAT LOG_MISS =
+        "Program binary cache - No valid binary for program (ID{:02}).";
+    LOGGER_FORMAT LOG_REJECTED =
+        "Program binary cache - Driver rejected binary at {}, relinking.";
+    LOGGER_FORMAT LOG_SAVE_FAILURE =
+        "Program binary cache - Unable to write binary to {}.";
+    LOGGER_FORMAT LOG_UNSUPPORTED =
+        "Program binary cache - No program binary formats supported.";
+};
+
+}   // namespace basil
@@ -2,6 +2,15 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+#include "GLTextureUnitAllocator.hpp"
+
+#include "Process/GLCallMetrics.hpp"
+
 namespace basil {
 
 void GLProgramUniformManager::setUniform(
@@ -10,6 +19,31 @@ void GLProgramUniformManager::setUniform(
     setUniformWithoutCache(uniform);
 }
 
+void GLProgramUniformManager::setUniforms(
+        std::span<const std::shared_ptr<GLUniform>> uniforms) {
+    batch.clear();
+
+    for (const auto& uniform : uniforms) {
+        cacheUniform(uniform);
+
+        if (auto storage =
+                std::dynamic_pointer_cast<GLUniformStorage>(uniform)) {
+            setStorageBlock(storage);
+        } else if (auto binding = bindUniform(*uniform)) {
+            batch.push_back(BatchEntry { binding, uniform });
+        }
+    }
+
+    std::sort(batch.begin(), batch.end(),
+        [](const BatchEntry& first, const BatchEntry& second) {
+            return first.binding->location < second.binding->location;
+        });
+
+    for (const auto& entry : batch) {
+        setUniformAt(entry.uniform, *entry.binding);
+    }
+}
+
 void GLProgramUniformManager::applyCachedUniforms() {
     for (auto uniform : uniformCache) {
         setUniformWithoutCache(uniform.second);
@@ -18,20 +52,79 @@ void GLProgramUniformManager::applyCachedUniforms() {
 
 void GLProgramUniformManager::setUniformWithoutCache(
         std::shared_ptr<GLUniform> uniform) {
-    int location = getUniformLocation(uniform->getName());
-    if (location == -1) return;
+    if (auto storage = std::dynamic_pointer_cast<GLUniformStorage>(uniform)) {
+        setStorageBlock(storage);
+        return;
+    }
+
+    const GLUniformBinding* binding = bindUniform(*uniform);
+    if (!binding) return;
+
+    setUniformAt(uniform, *binding);
+}
+
+void GLProgramUniformManager::setStorageBlock(
+        std::shared_ptr<GLUniformStorage> storage) {
+    const std::string name = storage->getName();
+    if (storageBlocks.contains(name)) {
+        errorHistory.erase(name);
+        storageBindings[storageBlocks.at(name)] = storage;
+        return;
+    }
+
+    if (errorHistory.contains(name)) return;
+
+    errorHistory.insert(name);
+    logger.log(
+        fmt::format(LOG_STORAGE_BLOCK_FAILURE,
+        programID, name),
+        LogLevel::DEBUG);
+}
+
+void GLProgramUniformManager::bindStorageBuffers() {
+    for (const auto& [binding, storage] : storageBindings) {
+        GLuint bufferID = storage->upload();
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, bufferID);
+        BASIL_COUNT_GL_CALL(GLCallType::BIND);
+    }
+}
 
-    setUniformAt(uniform, location);
+void GLProgramUniformManager::bindTextures() {
+    if (textureUniforms.empty()) return;
+
+    auto& allocator = GLTextureUnitAllocator::get();
+    allocator.beginDraw();
+    for (const auto& [name, uniform] : textureUniforms) {
+        // Samplers not used by the program do not take up a unit
+        const GLUniformBinding* binding = bindUniform(*uniform);
+        if (!binding) continue;
+
+        uniform->bindTextureUnit();
+        setUniformAt(uniform, *binding);
+    }
+    allocator.endDraw();
+}
+
+std::optional<GLuint> GLProgramUniformManager::getStorageBlockBinding(
+        const std::string& blockName) const {
+    if (!storageBlocks.contains(blockName)) return std::nullopt;
+
+    return std::optional(storageBlocks.at(blockName));
 }
 
 int GLProgramUniformManager::getUniformLocation(
         const std::string& name) {
-    int location = glGetUniformLocation(
+    int arrayIndex = 0;
+    const GLUniformInfo* info = findUniform(name, &arrayIndex);
+    if (!info && !errorHistory.contains(name)) {
+        info = queryUniform(name);
+    }
+    if (info) {
+        // Members of uniform blocks are not set by location
+        if (info->blockIndex != -1) return -1;
 
-        programID, name.c_str());
-    if (location > -1) {
         errorHistory.erase(name);
-        return location;
+        return info->location + arrayIndex;
     }
 
     if (errorHistory.contains(name)) return -1;
@@ -44,123 +137,481 @@ int GLProgramUniformManager::getUniformLocation(
     return -1;
 }
 
-template<>
-void GLProgramUniformManager::setUniformVectorOrMatrix<float>(
-        GLUniformSource<float> source,
-        unsigned int width, unsigned int length,
-        unsigned int count, int location) {
-    unsigned int signature = 4*(width - 1) + length;
-    float* data = source.data();
-    switch (signature) {
-        case 1:   // width: 1, length 1
-            glProgramUniform1fv(
-                programID, location, count, data);
-            break;
-        case 2:   // width: 1, length 2
-            glProgramUniform2fv(
-                programID, location, count, data);
-            break;
-        case 3:   // width: 1, length 3
-            glProgramUniform3fv(
-                programID, location, count, data);
-            break;
-        case 4:   // width: 1, length 4
-            glProgramUniform4fv(
-                programID, location, count, data);
-            break;
-        case 6:   // width: 2, length 2
-            glProgramUniformMatrix2fv(
-                programID, location, count, false, data);
-            break;
-        case 7:   // width: 2, length 3
-            glProgramUniformMatrix2x3fv(
-                programID, location, count, false, data);
-            break;
-        case 8:   // width: 2, length 4
-            glProgramUniformMatrix2x4fv(
-                programID, location, count, false, data);
-            break;
-        case 11:  // width: 3, length 3
-            glProgramUniformMatrix3fv(
-                programID, location, count, false, data);
-            break;
-        case 12:  // width: 3, length 4
-            glProgramUniformMatrix3x4fv(
-                programID, location, count, false, data);
-            break;
-        case 16:  // width: 4, length 4
-            glProgramUniformMatrix4fv(
-                programID, location, count, false, data);
-            break;
-    }
-}
-
-template<>
-void GLProgramUniformManager::setUniformVectorOrMatrix<int>(
-        GLUniformSource<int> source,
-        unsigned int width, unsigned int length,
-        unsigned int count, int location) {
-    unsigned int signature = 4*(width - 1) + length;
-    int* data = source.data();
-    switch (signature) {
-        case 1:
-            glProgramUniform1iv(
-                programID, location, count, data);
-            break;
-        case 2:
-            glProgramUniform2iv(
-                programID, location, count, data);
-            break;
-        case 3:
-            glProgramUniform3iv(
-                programID, location, count, data);
-            break;
-        case 4:
-            glProgramUniform4iv(
-                programID, location, count, data);
-            break;
-    }
-}
-
-template<>
-void GLProgramUniformManager::setUniformVectorOrMatrix<unsigned int>(
-        GLUniformSource<unsigned int> source,
-        unsigned int width, unsigned int length,
-        unsigned int count, int location) {
-    unsigned int signature = 4*(width - 1) + length;
-    unsigned int* data = source.data();
-    switch (signature) {
-        case 1:
-            glProgramUniform1uiv(
-                programID, location, count, data);
-            break;
-        case 2:
-            glProgramUniform2uiv(
-                programID, location, count, data);
-            break;
-        case 3:
-            glProgramUniform3uiv(
-                programID, location, count, data);
-            break;
-        case 4:
-            glProgramUniform4uiv(
-                programID, location, count, data);
-            break;
+void GLProgramUniformManager::loadUniformTable() {
+    clearUniformTable();
+    if (!programID) return;
+
+    GLint uniformCount = 0, maxNameLength = 0;
+    glGetProgramInterfaceiv(programID, GL_UNIFORM,
+        GL_ACTIVE_RESOURCES, &uniformCount);
+    glGetProgramInterfaceiv(programID, GL_UNIFORM,
+        GL_MAX_NAME_LENGTH, &maxNameLength);
+
+    const GLenum properties[] =
+        { GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE, GL_BLOCK_INDEX };
+    std::vector<char> nameBuffer(maxNameLength + 1, '\0');
+
+    uniformTable.reserve(uniformCount);
+    for (GLint index = 0; index < uniformCount; index++) {
+        GLint values[4];
+        glGetProgramResourceiv(programID, GL_UNIFORM, index,
+            4, properties, 4, nullptr, values);
+        glGetProgramResourceName(programID, GL_UNIFORM, index,
+            nameBuffer.size(), nullptr, nameBuffer.data());
+
+        // Arrays are reported as "name[0]"
+        std::string name(nameBuffer.data());
+        if (name.ends_with("[0]")) {
+            name.resize(name.size() - 3);
+            uniformIndices.emplace(name + "[0]", uniformTable.size());
+        }
+        uniformIndices.emplace(name, uniformTable.size());
+
+        uniformTable.push_back(GLUniformInfo {
+            .name = name,
+            .location = values[0],
+            .type = static_cast<GLenum>(values[1]),
+            .arraySize = values[2],
+            .blockIndex = values[3]
+        });
+    }
+
+    GLint blockCount = 0;
+    glGetProgramInterfaceiv(programID, GL_UNIFORM_BLOCK,
+        GL_ACTIVE_RESOURCES, &blockCount);
+    glGetProgramInterfaceiv(programID, GL_UNIFORM_BLOCK,
+        GL_MAX_NAME_LENGTH, &maxNameLength);
+    nameBuffer.assign(maxNameLength + 1, '\0');
+
+    for (GLint index = 0; index < blockCount; index++) {
+        glGetProgramResourceName(programID, GL_UNIFORM_BLOCK, index,
+            nameBuffer.size(), nullptr, nameBuffer.data());
+        uniformBlocks.emplace(nameBuffer.data(), index);
+    }
+
+    glGetProgramInterfaceiv(programID, GL_SHADER_STORAGE_BLOCK,
+        GL_ACTIVE_RESOURCES, &blockCount);
+    glGetProgramInterfaceiv(programID, GL_SHADER_STORAGE_BLOCK,
+        GL_MAX_NAME_LENGTH, &maxNameLength);
+    nameBuffer.assign(maxNameLength + 1, '\0');
+
+    for (GLint index = 0; index < blockCount; index++) {
+        glGetProgramResourceName(programID, GL_SHADER_STORAGE_BLOCK, index,
+            nameBuffer.size(), nullptr, nameBuffer.data());
+
+        // Unique within the program, as storage buffers are rebound on use
+        glShaderStorageBlockBinding(programID, index, index);
+        storageBlocks.emplace(nameBuffer.data(), index);
+    }
+}
+
+void GLProgramUniformManager::clearUniformTable() {
+    uniformTable.clear();
+    uniformIndices.clear();
+    queriedUniforms.clear();
+    uniformBlocks.clear();
+    storageBlocks.clear();
+    storageBindings.clear();
+    uniformBindings.clear();
+    errorHistory.clear();
+    mismatchHistory.clear();
+
+    // Linking resets uniform values to their defaults
+    uploadedValues.clear();
+}
+
+std::optional<GLUniformInfo> GLProgramUniformManager::getUniformInfo(
+        const std::string& name) const {
+    const GLUniformInfo* info = findUniform(name);
+    if (!info) return std::nullopt;
+
+    return std::optional(*info);
+}
+
+const GLUniformInfo* GLProgramUniformManager::findUniform(
+        const std::string& name, int* arrayIndex) const {
+    if (uniformIndices.contains(name)) {
+        return &uniformTable.at(uniformIndices.at(name));
+    }
+    if (auto found = queriedUniforms.find(name);
+            found != queriedUniforms.end()) {
+        return &found->second;
+    }
+
+    // Resolve individual array elements, e.g. "name[3]"
+    std::size_t bracket = name.find_last_of('[');
+    if (bracket == std::string::npos || !name.ends_with("]")) {
+        return nullptr;
+    }
+
+    std::string baseName = name.substr(0, bracket);
+    if (!uniformIndices.contains(baseName)) return nullptr;
+
+    int index = 0;
+    const char* first = name.data() + bracket + 1;
+    const char* last = name.data() + name.size() - 1;
+    auto [end, error] = std::from_chars(first, last, index);
+    if (error != std::errc() || end != last || first == last) {
+        return nullptr;
+    }
+
+    const GLUniformInfo* info = &uniformTable.at(uniformIndices.at(baseName));
+    if (index < 0 || index >= info->arraySize) return nullptr;
+
+    if (arrayIndex) *arrayIndex = index;
+    return info;
+}
+
+const GLUniformInfo* GLProgramUniformManager::queryUniform(
+        const std::string& name) {
+    if (!programID || uniformTable.empty()) return nullptr;
+
+    // Names not in the table, e.g. "lights[1].values[2]" for an array
+    // within an array of structs, are resolved by the driver
+    GLint location = glGetProgramResourceLocation(
+        programID, GL_UNIFORM, name.c_str());
+    if (location == -1) return nullptr;
+
+    // Resource is named after first element of innermost array
+    std::string resourceName = name;
+    std::size_t bracket = resourceName.find_last_of('[');
+    if (bracket != std::string::npos && resourceName.ends_with("]")) {
+        resourceName.resize(bracket);
+    }
+    GLuint index = glGetProgramResourceIndex(
+        programID, GL_UNIFORM, resourceName.c_str());
+    if (index == GL_INVALID_INDEX) return nullptr;
+
+    const GLenum properties[] = { GL_TYPE, GL_BLOCK_INDEX };
+    GLint values[2];
+    glGetProgramResourceiv(programID, GL_UNIFORM, index,
+        2, properties, 2, nullptr, values);
+
+    auto [inserted, isInserted] = queriedUniforms.emplace(name,
+        GLUniformInfo {
+            .name = name,
+            .location = location,
+            .type = static_cast<GLenum>(values[0]),
+            .arraySize = 1,
+            .blockIndex = values[1]
+        });
+    return &inserted->second;
+}
+
+const GLUniformBinding* GLProgramUniformManager::bindUniform(
+        const GLUniform& uniform) {
+    const std::string& name = uniform.getName();
+    std::size_t sourceIndex = uniform.getSource().index();
+
+    // Re-resolve only if the shape of the uniform has changed
+    auto iterator = uniformBindings.find(name);
+    if (iterator != uniformBindings.end()
+            && iterator->second.sourceIndex == sourceIndex
+            && iterator->second.length == uniform.getLength()
+            && iterator->second.width == uniform.getWidth()) {
+        return &iterator->second;
+    }
+
+    int location = getUniformLocation(name);
+    if (location == -1) return nullptr;
+
+    int arrayIndex = 0;
+    const GLUniformInfo* info = findUniform(name, &arrayIndex);
+    GLUniformSetter setter = resolveSetter(info->type, uniform);
+    if (!setter) {
+        if (mismatchHistory.insert(name).second) {
+            logger.log(
+                fmt::format(LOG_SHAPE_MISMATCH, programID, name,
+                    uniform.getSourceTypeName(), uniform.getWidth(),
+                    uniform.getLength(), info->type),
+                LogLevel::WARN);
+        }
+        return nullptr;
+    }
+
+    mismatchHistory.erase(name);
+    uniformBindings[name] = GLUniformBinding {
+        .location = location,
+        .setter = setter,
+        .sourceIndex = sourceIndex,
+        .length = uniform.getLength(),
+        .width = uniform.getWidth(),
+        .arrayIndex = arrayIndex,
+        .arraySize = info->arraySize
+    };
+
+    return &uniformBindings.at(name);
+}
+
+GLUniformSetter GLProgramUniformManager::resolveSetter(
+        GLenum type, const GLUniform& uniform) {
+    enum class Kind { FLOAT, DOUBLE, INT, UINT, BOOLEAN, SAMPLER };
+    struct TypeShape { Kind kind; unsigned int columns; unsigned int rows; };
+
+    TypeShape shape;
+    switch (type) {
+        case GL_FLOAT:              shape = { Kind::FLOAT, 1, 1 }; break;
+        case GL_FLOAT_VEC2:         shape = { Kind::FLOAT, 1, 2 }; break;
+        case GL_FLOAT_VEC3:         shape = { Kind::FLOAT, 1, 3 }; break;
+        case GL_FLOAT_VEC4:         shape = { Kind::FLOAT, 1, 4 }; break;
+        case GL_FLOAT_MAT2:         shape = { Kind::FLOAT, 2, 2 }; break;
+        case GL_FLOAT_MAT2x3:       shape = { Kind::FLOAT, 2, 3 }; break;
+        case GL_FLOAT_MAT2x4:       shape = { Kind::FLOAT, 2, 4 }; break;
+        case GL_FLOAT_MAT3x2:       shape = { Kind::FLOAT, 3, 2 }; break;
+        case GL_FLOAT_MAT3:         shape = { Kind::FLOAT, 3, 3 }; break;
+        case GL_FLOAT_MAT3x4:       shape = { Kind::FLOAT, 3, 4 }; break;
+        case GL_FLOAT_MAT4x2:       shape = { Kind::FLOAT, 4, 2 }; break;
+        case GL_FLOAT_MAT4x3:       shape = { Kind::FLOAT, 4, 3 }; break;
+        case GL_FLOAT_MAT4:         shape = { Kind::FLOAT, 4, 4 }; break;
+        case GL_DOUBLE:             shape = { Kind::DOUBLE, 1, 1 }; break;
+        case GL_DOUBLE_VEC2:        shape = { Kind::DOUBLE, 1, 2 }; break;
+        case GL_DOUBLE_VEC3:        shape = { Kind::DOUBLE, 1, 3 }; break;
+        case GL_DOUBLE_VEC4:        shape = { Kind::DOUBLE, 1, 4 }; break;
+        case GL_DOUBLE_MAT2:        shape = { Kind::DOUBLE, 2, 2 }; break;
+        case GL_DOUBLE_MAT2x3:      shape = { Kind::DOUBLE, 2, 3 }; break;
+        case GL_DOUBLE_MAT2x4:      shape = { Kind::DOUBLE, 2, 4 }; break;
+        case GL_DOUBLE_MAT3x2:      shape = { Kind::DOUBLE, 3, 2 }; break;
+        case GL_DOUBLE_MAT3:        shape = { Kind::DOUBLE, 3, 3 }; break;
+        case GL_DOUBLE_MAT3x4:      shape = { Kind::DOUBLE, 3, 4 }; break;
+        case GL_DOUBLE_MAT4x2:      shape = { Kind::DOUBLE, 4, 2 }; break;
+        case GL_DOUBLE_MAT4x3:      shape = { Kind::DOUBLE, 4, 3 }; break;
+        case GL_DOUBLE_MAT4:        shape = { Kind::DOUBLE, 4, 4 }; break;
+        case GL_INT:                shape = { Kind::INT, 1, 1 }; break;
+        case GL_INT_VEC2:           shape = { Kind::INT, 1, 2 }; break;
+        case GL_INT_VEC3:           shape = { Kind::INT, 1, 3 }; break;
+        case GL_INT_VEC4:           shape = { Kind::INT, 1, 4 }; break;
+        case GL_UNSIGNED_INT:       shape = { Kind::UINT, 1, 1 }; break;
+        case GL_UNSIGNED_INT_VEC2:  shape = { Kind::UINT, 1, 2 }; break;
+        case GL_UNSIGNED_INT_VEC3:  shape = { Kind::UINT, 1, 3 }; break;
+        case GL_UNSIGNED_INT_VEC4:  shape = { Kind::UINT, 1, 4 }; break;
+        case GL_BOOL:               shape = { Kind::BOOLEAN, 1, 1 }; break;
+        case GL_BOOL_VEC2:          shape = { Kind::BOOLEAN, 1, 2 }; break;
+        case GL_BOOL_VEC3:          shape = { Kind::BOOLEAN, 1, 3 }; break;
+        case GL_BOOL_VEC4:          shape = { Kind::BOOLEAN, 1, 4 }; break;
+        // Samplers, images and other opaque types are set as integers
+        default:                    shape = { Kind::SAMPLER, 1, 1 }; break;
+    }
+
+    if (uniform.getWidth() != shape.columns
+            || uniform.getLength() != shape.rows) {
+        return nullptr;
+    }
+
+    // Booleans accept any single-precision source type,
+    // other types must match exactly
+    Kind sourceKind = std::visit([](const auto& source) {
+            using T = std::remove_pointer_t<decltype(source.data())>;
+            if constexpr (std::is_same_v<T, float>) return Kind::FLOAT;
+            if constexpr (std::is_same_v<T, double>) return Kind::DOUBLE;
+            if constexpr (std::is_same_v<T, unsigned int>) return Kind::UINT;
+            return Kind::INT;
+        }, uniform.getSource());
+    bool isCompatible = shape.kind == sourceKind
+        || (shape.kind == Kind::BOOLEAN && sourceKind != Kind::DOUBLE)
+        || (shape.kind == Kind::SAMPLER && sourceKind == Kind::INT);
+    if (!isCompatible) return nullptr;
+
+    // Indexed by [columns - 1][rows - 1]
+    static const GLUniformSetter FLOAT_SETTERS[4][4] = {
+        {
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform1fv(p, l, c, static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform2fv(p, l, c, static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform3fv(p, l, c, static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform4fv(p, l, c, static_cast<const GLfloat*>(d)); }
+        }, {
+            nullptr,
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix2fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix2x3fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix2x4fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); }
+        }, {
+            nullptr,
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix3x2fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix3fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix3x4fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); }
+        }, {
+            nullptr,
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix4x2fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix4x3fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix4fv(p, l, c, GL_FALSE,
+                    static_cast<const GLfloat*>(d)); }
+        }
+    };
+
+    static const GLUniformSetter DOUBLE_SETTERS[4][4] = {
+        {
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform1dv(p, l, c,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform2dv(p, l, c,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform3dv(p, l, c,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniform4dv(p, l, c,
+                    static_cast<const GLdouble*>(d)); }
+        }, {
+            nullptr,
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix2dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix2x3dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix2x4dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); }
+        }, {
+            nullptr,
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix3x2dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix3dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix3x4dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); }
+        }, {
+            nullptr,
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix4x2dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix4x3dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); },
+            [](GLuint p, GLint l, GLsizei c, const void* d) {
+                glProgramUniformMatrix4dv(p, l, c, GL_FALSE,
+                    static_cast<const GLdouble*>(d)); }
+        }
+    };
+
+    // Indexed by [rows - 1]
+    static const GLUniformSetter INT_SETTERS[4] = {
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform1iv(p, l, c, static_cast<const GLint*>(d)); },
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform2iv(p, l, c, static_cast<const GLint*>(d)); },
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform3iv(p, l, c, static_cast<const GLint*>(d)); },
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform4iv(p, l, c, static_cast<const GLint*>(d)); }
+    };
+
+    static const GLUniformSetter UINT_SETTERS[4] = {
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform1uiv(p, l, c, static_cast<const GLuint*>(d)); },
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform2uiv(p, l, c, static_cast<const GLuint*>(d)); },
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform3uiv(p, l, c, static_cast<const GLuint*>(d)); },
+        [](GLuint p, GLint l, GLsizei c, const void* d) {
+            glProgramUniform4uiv(p, l, c, static_cast<const GLuint*>(d)); }
+    };
+
+    switch (sourceKind) {
+        case Kind::FLOAT:
+            return FLOAT_SETTERS[shape.columns - 1][shape.rows - 1];
+        case Kind::DOUBLE:
+            return DOUBLE_SETTERS[shape.columns - 1][shape.rows - 1];
+        case Kind::UINT:
+            return UINT_SETTERS[shape.rows - 1];
+        default:
+            return INT_SETTERS[shape.rows - 1];
     }
 }
 
 void GLProgramUniformManager::setUniformAt(
-        std::shared_ptr<GLUniform> uniform, int location) {
-    auto uniformSource = uniform->getSource();
-    std::visit([&](auto source) {
-            setUniformVectorOrMatrix(source,
-                uniform->getWidth(), uniform->getLength(),
-                uniform->getCount(), location); },
-        uniformSource);
+        std::shared_ptr<GLUniform> uniform, const GLUniformBinding& binding) {
+    if (!updateUploadedValue(uniform, binding)) {
+        uploadStats.skips++;
+        return;
+    }
+    uploadStats.uploads++;
+
+    binding.setter(programID, binding.location,
+        uniform->getCount(), uniform->getData());
+    BASIL_COUNT_GL_CALL(GLCallType::UNIFORM, uniform->getDataSize());
+}
+
+bool GLProgramUniformManager::updateUploadedValue(
+        std::shared_ptr<GLUniform> uniform,
+        const GLUniformBinding& binding) {
+    const std::byte* data = static_cast<const std::byte*>(uniform->getData());
+    std::size_t size = uniform->getDataSize();
+    if (!data) return true;
+
+    std::vector<std::byte>& uploaded = uploadedValues[binding.location];
+    if (uploaded.size() == size
+            && std::memcmp(uploaded.data(), data, size) == 0) {
+        return false;
+    }
+
+    uploaded.assign(data, data + size);
+    if (binding.arraySize > 1 && uniform->getCount() > 0) {
+        patchUploadedElements(binding, std::span(data, size),
+            size / uniform->getCount());
+    }
+    return true;
+}
+
+void GLProgramUniformManager::patchUploadedElements(
+        const GLUniformBinding& binding,
+        std::span<const std::byte> data,
+        std::size_t elementSize) {
+    // Values cached at other elements of the array overlap this write,
+    // e.g. the whole array after setting "name[1]"
+    int firstLocation = binding.location - binding.arrayIndex;
+    for (int location = firstLocation;
+            location < firstLocation + binding.arraySize; location++) {
+        if (location == binding.location) continue;
+
+        auto found = uploadedValues.find(location);
+        if (found == uploadedValues.end()) continue;
+
+        std::vector<std::byte>& cached = found->second;
+        std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(elementSize)
+            * (binding.location - location);
+        std::ptrdiff_t begin = std::max<std::ptrdiff_t>(offset, 0);
+        std::ptrdiff_t end = std::min<std::ptrdiff_t>(
+            offset + data.size(), cached.size());
+        if (begin >= end) continue;
+
+        std::memcpy(cached.data() + begin,
+            data.data() + (begin - offset), end - begin);
+    }
 }
 
 void GLProgramUniformManager::cacheUniform(std::shared_ptr<GLUniform> uniform) {
     std::string name = uniform->getName();
+    if (auto texture = std::dynamic_pointer_cast<GLUniformTexture>(uniform)) {
+        textureUniforms[name] = texture;
+    } else {
+        textureUniforms.erase(name);
+    }
+
     if (uniformCache.contains(name)) {
         uniformCache.at(name) = uniform;
     } else {
@@ -1,17 +1,78 @@
 #pragma once
 
 #include <map>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <Basil/Packages/Context.hpp>
 
 #include "GLUniform.hpp"
+#include "GLUniformStorage.hpp"
 
 namespace basil {
 
+/** @brief Description of an active uniform in a linked shader program */
+struct GLUniformInfo {
+    /** @brief Name of uniform, without array subscript */
+    std::string name;
+
+    /** @brief Location of uniform, or -1 if declared in a uniform block */
+    int location = -1;
+
+    /** @brief OpenGL type enum, e.g. GL_FLOAT_VEC3 */
+    GLenum type = 0;
+
+    /** @brief Number of array elements, or 1 for non-arrays */
+    int arraySize = 1;
+
+    /** @brief Index of containing uniform block, or -1 if none */
+    int blockIndex = -1;
+};
+
+/** @brief Function uploading count values of a uniform to a location */
+using GLUniformSetter = void (*)(
+    GLuint programID, GLint location, GLsizei count, const void* data);
+
+/** @brief Uniform bound to a location, with setter resolved for the
+ *  combination of the uniform's shape and the declared shader type */
+struct GLUniformBinding {
+    /** @brief Location of uniform in program */
+    int location = -1;
+
+    /** @brief Setter matching shape and shader type */
+    GLUniformSetter setter = nullptr;
+
+    /** @brief Index of uniform source type in GLUniformSourceGeneric */
+    std::size_t sourceIndex = 0;
+
+    /** @brief Length of uniform vector, or first matrix dimension */
+    unsigned int length = 0;
+
+    /** @brief Second matrix dimension */
+    unsigned int width = 0;
+
+    /** @brief Index of first element set, for elements of arrays */
+    int arrayIndex = 0;
+
+    /** @brief Number of elements in array containing uniform */
+    int arraySize = 1;
+};
+
+/** @brief Counters of uniform uploads issued and skipped as redundant */
+struct GLUniformUploadStats {
+    /** @brief Number of values uploaded to OpenGL */
+    unsigned int uploads = 0;
+
+    /** @brief Number of uploads skipped, as value was already set */
+    unsigned int skips = 0;
+};
+
 /** @brief Class which manages the caching and setting of OpenGL uniform
  *  values within a shader program. */
 class GLProgramUniformManager : private IBasilContextConsumer {
@@ -27,9 +88,63 @@ class GLProgramUniformManager : private IBasilContextConsumer {
     /** @brief Add or change a uniform */
     void setUniform(std::shared_ptr<GLUniform> uniform);
 
+    /** @brief Add or change several uniforms, uploading changed values
+     *  in order of location once all uniforms have been bound */
+    void setUniforms(std::span<const std::shared_ptr<GLUniform>> uniforms);
+
+    /** @returns Uniforms applied to program, by name */
+    const std::map<std::string, std::shared_ptr<GLUniform>>&
+    getCachedUniforms() const {
+        return uniformCache;
+    }
+
     /** @brief Update uniforms in shader program based on cache */
     void applyCachedUniforms();
 
+    /** @brief Upload changed storage block data, and bind storage
+     *  buffers to the blocks of the program. Binding points are shared
+     *  between programs, so must be repeated before each use. */
+    void bindStorageBuffers();
+
+    /** @brief Bind textures of sampler uniforms used by the program to
+     *  texture units, and set the uniforms to their units. Units are
+     *  shared between programs, so must be repeated before each use. */
+    void bindTextures();
+
+    /** @brief Query active uniforms, uniform blocks and storage blocks
+     *  of the linked program, replacing any previously loaded table.
+     *  Each storage block is assigned a binding point equal to its
+     *  block index. Must be called after each link. */
+    void loadUniformTable();
+
+    /** @brief Clear uniform table, e.g. after failing to link */
+    void clearUniformTable();
+
+    /** @returns Description of active uniform with name, if found.
+     *  Accepts names with or without array subscript. */
+    std::optional<GLUniformInfo> getUniformInfo(
+        const std::string& name) const;
+
+    /** @returns Table of active uniforms in linked program */
+    const std::vector<GLUniformInfo>& getUniformTable() const {
+        return uniformTable;
+    }
+
+    /** @returns Whether linked program declares uniform block with name */
+    bool hasUniformBlock(const std::string& blockName) const {
+        return uniformBlocks.contains(blockName);
+    }
+
+    /** @returns Binding point of storage block with name, if found */
+    std::optional<GLuint> getStorageBlockBinding(
+        const std::string& blockName) const;
+
+    /** @returns Counts of uploaded and skipped uniform values */
+    GLUniformUploadStats getUploadStats() const { return uploadStats; }
+
+    /** @brief Reset counts of uploaded and skipped uniform values */
+    void resetUploadStats() { uploadStats = GLUniformUploadStats(); }
+
 #ifndef TEST_BUILD
 
  private:
@@ -37,26 +152,64 @@ class GLProgramUniformManager : private IBasilContextConsumer {
     unsigned int programID;
 
     int getUniformLocation(const std::string& uniform);
-    void setUniformAt(std::shared_ptr<GLUniform> uniform, int location);
+    void setUniformAt(std::shared_ptr<GLUniform> uniform,
+        const GLUniformBinding& binding);
     void setUniformWithoutCache(std::shared_ptr<GLUniform> uniform);
+    void setStorageBlock(std::shared_ptr<GLUniformStorage> storage);
+
+    const GLUniformBinding* bindUniform(const GLUniform& uniform);
 
-    template<GLUniformSourceType T>
-    void setUniformVectorOrMatrix(
-        GLUniformSource<T> source,
-        unsigned int width, unsigned int length,
-        unsigned int count, int location);
+    static GLUniformSetter resolveSetter(
+        GLenum type, const GLUniform& uniform);
 
     void cacheUniform(std::shared_ptr<GLUniform> uniform);
 
+    bool updateUploadedValue(
+        std::shared_ptr<GLUniform> uniform,
+        const GLUniformBinding& binding);
+    void patchUploadedElements(const GLUniformBinding& binding,
+        std::span<const std::byte> data, std::size_t elementSize);
+
+    const GLUniformInfo* findUniform(
+        const std::string& name, int* arrayIndex = nullptr) const;
+    const GLUniformInfo* queryUniform(const std::string& name);
+
     std::map<std::string, std::shared_ptr<GLUniform>> uniformCache;
+    std::map<std::string, std::shared_ptr<GLUniformTexture>>
+        textureUniforms;
     std::set<std::string> errorHistory;
 
+    std::vector<GLUniformInfo> uniformTable;
+    std::unordered_map<std::string, unsigned int> uniformIndices;
+    std::unordered_map<std::string, GLUniformInfo> queriedUniforms;
+    std::unordered_map<std::string, GLUniformBinding> uniformBindings;
+
+    struct BatchEntry {
+        const GLUniformBinding* binding;
+        std::shared_ptr<GLUniform> uniform;
+    };
+    std::vector<BatchEntry> batch;
+    std::set<std::string> mismatchHistory;
+
+    std::unordered_map<std::string, GLuint> uniformBlocks;
+    std::unordered_map<std::string, GLuint> storageBlocks;
+    std::map<GLuint, std::shared_ptr<GLUniformStorage>> storageBindings;
+
+    std::unordered_map<int, std::vector<std::byte>> uploadedValues;
+    GLUniformUploadStats uploadStats;
+
 
     Logger& logger = Logger::get();
 
     LOGGER_FORMAT LOG_UNIFORM_FAILURE =
         "Shader Program (ID{:02}) - Could not get location for uniform "
         "with name \"{}\".";
+    LOGGER_FORMAT LOG_SHAPE_MISMATCH =
+        "Shader Program (ID{:02}) - Uniform \"{}\" with {} values of "
+        "shape {}x{} does not match declared type (0x{:04X}).";
+    LOGGER_FORMAT LOG_STORAGE_BLOCK_FAILURE =
+        "Shader Program (ID{:02}) - Could not find storage block "
+        "with name \"{}\".";
 };
 
 }  // namespace basil
@@ -0,0 +1,65 @@
+#include <functional>
+
+#include "GLResourceRegistry.hpp"
+
+namespace basil {
+
+template<class T>
+std::shared_ptr<T> GLResourceRegistry::getShader(
+        ShaderMap<T>& shaders, const std::string& shaderCode) {
+    std::size_t hash = std::hash<std::string>{}(shaderCode);
+
+    std::shared_ptr<T> shader = nullptr;
+    if (auto found = shaders.find(hash); found != shaders.end()) {
+        shader = found->second.lock();
+    }
+
+    if (shader && shader->getShaderCode() == shaderCode) {
+        return shader;
+    }
+
+    // Leave a live shader with a colliding hash registered
+    auto newShader = std::make_shared<T>(shaderCode);
+    if (!shader) {
+        std::erase_if(shaders, [](const auto& entry) {
+            return entry.second.expired();
+        });
+        shaders[hash] = newShader;
+    }
+    return newShader;
+}
+
+std::shared_ptr<GLVertexShader> GLResourceRegistry::getVertexShader(
+        const std::string& shaderCode) {
+    return getShader(vertexShaders, shaderCode);
+}
+
+std::shared_ptr<GLFragmentShader> GLResourceRegistry::getFragmentShader(
+        const std::string& shaderCode) {
+    return getShader(fragmentShaders, shaderCode);
+}
+
+std::shared_ptr<GLScreenGeometry> GLResourceRegistry::getScreenGeometry() {
+    if (auto geometry = screenGeometry.lock()) {
+        return geometry;
+    }
+
+    auto geometry = std::make_shared<GLScreenGeometry>();
+    screenGeometry = geometry;
+    return geometry;
+}
+
+std::size_t GLResourceRegistry::getSize() const {
+    auto countLive = [](const auto& registry) {
+        std::size_t count = 0;
+        for (const auto& [key, resource] : registry) {
+            count += !resource.expired();
+        }
+        return count;
+    };
+
+    return countLive(vertexShaders) + countLive(fragmentShaders)
+        + !screenGeometry.expired();
+}
+
+}  // namespace basil
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "GLScreenGeometry.hpp"
+#include "GLShader.hpp"
+
+namespace basil {
+
+/** @brief Registry of GPU resources shared between panes, using
+ *  Singleton pattern. Shaders are deduplicated by the hash of their
+ *  code. Programs are not shared, as each holds its own uniforms.
+ *  Resources are held weakly, so each is deleted once its last user
+ *  releases it. */
+class GLResourceRegistry {
+ public:
+    /** @return Instance of Singleton registry. */
+    static GLResourceRegistry& get() {
+        static GLResourceRegistry instance;
+        return instance;
+    }
+
+    /** @returns Vertex shader compiled from code, shared with any
+     *  other user of the same code. */
+    std::shared_ptr<GLVertexShader> getVertexShader(
+        const std::string& shaderCode);
+
+    /** @returns Fragment shader compiled from code, shared with any
+     *  other user of the same code. */
+    std::shared_ptr<GLFragmentShader> getFragmentShader(
+        const std::string& shaderCode);
+
+    /** @returns Vertex array covering the viewport. */
+    std::shared_ptr<GLScreenGeometry> getScreenGeometry();
+
+    /** @returns Number of registered resources still in use. */
+    std::size_t getSize() const;
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    template<class T>
+    using ShaderMap = std::map<std::size_t, std::weak_ptr<T>>;
+
+    GLResourceRegistry() = default;
+
+    template<class T>
+    std::shared_ptr<T> getShader(ShaderMap<T>& shaders,
+        const std::string& shaderCode);
+
+    ShaderMap<GLVertexShader> vertexShaders;
+    ShaderMap<GLFragmentShader> fragmentShaders;
+    std::weak_ptr<GLScreenGeometry> screenGeometry;
+};
+
+}   // namespace basil
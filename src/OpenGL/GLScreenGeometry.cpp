@@ -0,0 +1,72 @@
+#include "GLScreenGeometry.hpp"
+#include "GLStateCache.hpp"
+
+#include "Process/GLCallMetrics.hpp"
+
+namespace basil {
+
+GLScreenGeometry::GLScreenGeometry() {
+    glGenVertexArrays(1, &vertexArrayID);
+    GLStateCache::get().bindVertexArray(vertexArrayID);
+
+    createVertexBuffer();
+    createElementBuffer();
+}
+
+void GLScreenGeometry::createVertexBuffer() {
+    // Copy vertices of unit quad into buffer
+    float vertices[] = {
+         // Position              // UV coordinates
+         1.0f,  1.0f,  0.0f,      1.0f,  1.0f,  // Top    right
+         1.0f, -1.0f,  0.0f,      1.0f,  0.0f,  // Bottom right
+        -1.0f, -1.0f,  0.0f,      0.0f,  0.0f,  // Bottom left
+        -1.0f,  1.0f,  0.0f,      0.0f,  1.0f   // Top    left
+    };
+    glGenBuffers(1, &vertexBufferID);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Set up vertex attributes
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
+        5 * sizeof(float),
+        reinterpret_cast<void*>(0));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE,
+        5 * sizeof(float),
+        reinterpret_cast<void*>(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+}
+
+void GLScreenGeometry::createElementBuffer() {
+    // Copy indices into element buffer
+    unsigned int indices[] = {
+        0, 1, 3,
+        1, 2, 3,
+    };
+    glGenBuffers(1, &elementBufferID);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBufferID);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+        sizeof(indices), indices, GL_STATIC_DRAW);
+}
+
+void GLScreenGeometry::draw(bool hasVertexAttributes) const {
+    GLStateCache::get().bindVertexArray(vertexArrayID);
+
+    if (hasVertexAttributes) {
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    } else {
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    BASIL_COUNT_GL_CALL(GLCallType::DRAW);
+}
+
+GLScreenGeometry::~GLScreenGeometry() {
+    GLuint vertexArrays[] = { vertexArrayID };
+    glDeleteVertexArrays(1, vertexArrays);
+    GLStateCache::get().releaseVertexArray(vertexArrayID);
+
+    GLuint bufferArrays[] = { elementBufferID, vertexBufferID };
+    glDeleteBuffers(2, bufferArrays);
+}
+
+}  // namespace basil
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <Basil/Packages/Context.hpp>
+
+namespace basil {
+
+/** @brief Vertex array covering the viewport, shared by every pane
+ *  through GLResourceRegistry. Holds a unit quad with position and UV
+ *  attributes, for vertex shaders which read them. Programs without
+ *  vertex attributes are drawn as a single fullscreen triangle, whose
+ *  vertices the vertex shader generates from gl_VertexID. */
+class GLScreenGeometry : private IBasilContextConsumer {
+ public:
+    /** @brief Create vertex array and buffers of unit quad. */
+    GLScreenGeometry();
+
+    /** @brief Tear down OpenGL vertex array and buffers. */
+    ~GLScreenGeometry();
+
+    GLScreenGeometry(const GLScreenGeometry&) = delete;
+    GLScreenGeometry& operator=(const GLScreenGeometry&) = delete;
+
+    /** @brief Draw over the viewport.
+     *  @param hasVertexAttributes  Whether to draw the quad, rather
+     *                              than the attributeless triangle */
+    void draw(bool hasVertexAttributes) const;
+
+    /** @returns ID of vertex array object. */
+    GLuint getVertexArrayID() const { return vertexArrayID; }
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    void createVertexBuffer();
+    void createElementBuffer();
+
+    GLuint vertexArrayID = 0;
+    GLuint vertexBufferID = 0;
+    GLuint elementBufferID = 0;
+};
+
+}   // namespace basil
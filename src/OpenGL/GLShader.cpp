@@ -1,8 +1,9 @@
 #include <fmt/format.h>
 
-#include <fstream>
+#include <optional>
 
 #include "GLShader.hpp"
+#include "GLResourceRegistry.hpp"
 
 using filepath = std::filesystem::path;
 
@@ -11,11 +12,18 @@ namespace basil {
 GLVertexShader::GLVertexShader(filepath path)
     : GLShader::GLShader(path, ShaderType::VERTEX) {}
 
+GLVertexShader::GLVertexShader(filepath path, CompileMode mode,
+        const GLShaderDefines& defines)
+    : GLShader::GLShader(path, ShaderType::VERTEX, mode, defines) {}
+
+GLVertexShader::GLVertexShader(const GLShaderSource& source, CompileMode mode)
+    : GLShader::GLShader(source, ShaderType::VERTEX, mode) {}
+
 GLVertexShader::GLVertexShader(const std::string &shaderCode)
     : GLShader::GLShader(shaderCode, ShaderType::VERTEX) {}
 
 std::shared_ptr<GLVertexShader> GLVertexShader::noOpShader() {
-    return std::make_shared<GLVertexShader>(NO_OP_VERTEX_CODE);
+    return GLResourceRegistry::get().getVertexShader(NO_OP_VERTEX_CODE);
 }
 
 void GLVertexShader::setShader(filepath path) {
@@ -30,11 +38,19 @@ void GLVertexShader::setShader(const std::string &shaderCode) {
 GLFragmentShader::GLFragmentShader(filepath path)
     : GLShader::GLShader(path, ShaderType::FRAGMENT) {}
 
+GLFragmentShader::GLFragmentShader(filepath path, CompileMode mode,
+        const GLShaderDefines& defines)
+    : GLShader::GLShader(path, ShaderType::FRAGMENT, mode, defines) {}
+
+GLFragmentShader::GLFragmentShader(
+        const GLShaderSource& source, CompileMode mode)
+    : GLShader::GLShader(source, ShaderType::FRAGMENT, mode) {}
+
 GLFragmentShader::GLFragmentShader(const std::string &shaderCode)
     : GLShader::GLShader(shaderCode, ShaderType::FRAGMENT) {}
 
 std::shared_ptr<GLFragmentShader> GLFragmentShader::debugShader() {
-    return std::make_shared<GLFragmentShader>(DEBUG_FRAGMENT_CODE);
+    return GLResourceRegistry::get().getFragmentShader(DEBUG_FRAGMENT_CODE);
 }
 
 void GLFragmentShader::setShader(filepath path) {
@@ -46,8 +62,15 @@ void GLFragmentShader::setShader(const std::string &shaderCode) {
 }
 
 
-GLShader::GLShader(filepath path, ShaderType type) {
-    getShaderFromFile(path);
+GLShader::GLShader(filepath path, ShaderType type, CompileMode mode,
+        const GLShaderDefines& defines) : compileMode(mode) {
+    getShaderFromFile(path, defines);
+    compileShader(type);
+}
+
+GLShader::GLShader(const GLShaderSource& source, ShaderType type,
+        CompileMode mode) : compileMode(mode) {
+    getShaderFromSource(source);
     compileShader(type);
 }
 
@@ -73,66 +96,98 @@ void GLShader::setShaderWithType(
 
 void GLShader::getShaderFromString(const std::string &shaderCode) {
     this->rawShaderCode = shaderCode;
+    dependencies.clear();
     hasCompiled = true;
 }
 
 void GLShader::getShaderFromFile(
-        std::filesystem::path path) {
-    // Read .st or .shadertoy files as ShaderToy format
-    bool shouldTranslateShaderToy =
-        path.extension() == ".st" || path.extension() == ".shadertoy";
-
-    // Read shader code from file
-    std::ifstream shaderFile;
-    shaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    try {
-        shaderFile.open(path);
-        std::stringstream shaderStream;
-        shaderStream << shaderFile.rdbuf();
-        shaderFile.close();
-        rawShaderCode = shaderStream.str();
+        std::filesystem::path path, const GLShaderDefines& defines) {
+    // Resolve includes and inject defines, logging any failure
+    std::optional<GLShaderSource> source =
+        GLShaderPreprocessor(defines).processFile(path);
 
-        logger.log(
-            fmt::format(LOG_READ_SUCCESS),
-            LogLevel::DEBUG);
-        hasCompiled = true;
+    if (!source.has_value()) {
+        hasCompiled = false;
+        return;
+    }
+    getShaderFromSource(source.value());
+}
 
+void GLShader::getShaderFromSource(const GLShaderSource& source) {
+    rawShaderCode = source.code;
+    dependencies = source.dependencies;
 
-        if (shouldTranslateShaderToy) {
-            logger.log(
-               fmt::format(LOG_TRANSLATE_SHADERTOY),
-                LogLevel::DEBUG);
-            rawShaderCode = SHADERTOY_PREFIX + rawShaderCode + SHADERTOY_SUFFIX;
-        }
-    } catch(std::ifstream::failure& error) {
-        logger.log(
-            fmt::format(LOG_READ_FAILURE, path.string()),
-            LogLevel::ERROR);
+    logger.log(
+        fmt::format(LOG_READ_SUCCESS),
+        LogLevel::DEBUG);
+    hasCompiled = true;
+
+    // Read .st or .shadertoy files as ShaderToy format
+    if (dependencies.empty()) return;
+    auto extension = dependencies.front().extension();
+    if (extension == ".st" || extension == ".shadertoy") {
         logger.log(
-            strerror(errno),
-            LogLevel::ERROR);
-        hasCompiled = false;
+            fmt::format(LOG_TRANSLATE_SHADERTOY),
+            LogLevel::DEBUG);
+        rawShaderCode = SHADERTOY_PREFIX + rawShaderCode + SHADERTOY_SUFFIX;
+    }
+}
+
+bool GLShader::hasCompiledSuccessfully() {
+    if (isStatusPending) {
+        checkCompileStatus();
     }
+    return hasCompiled;
+}
+
+bool GLShader::isCompileComplete() {
+    if (!isStatusPending || !supportsParallelCompile()) return true;
+
+    GLint isComplete = GL_FALSE;
+    glGetShaderiv(ID, GL_COMPLETION_STATUS_KHR, &isComplete);
+    return isComplete == GL_TRUE;
+}
+
+bool GLShader::supportsParallelCompile() {
+    static const bool isSupported = [] {
+        if (!GLEW_KHR_parallel_shader_compile) return false;
+
+        // Let the driver choose the number of compiler threads
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        return true;
+    }();
+    return isSupported;
 }
 
 void GLShader::compileShader(ShaderType type) {
     // Compile the shader
-    std::string typeString;
+    shaderType = type;
     switch (type) {
         case ShaderType::FRAGMENT:
             ID = glCreateShader(GL_FRAGMENT_SHADER);
-            typeString = "fragment";
             break;
         case ShaderType::VERTEX:
             ID = glCreateShader(GL_VERTEX_SHADER);
-            typeString = "vertex";
             break;
     }
 
-    GLint success;
     const char* rawShaderCode_cstr = rawShaderCode.c_str();
     glShaderSource(ID, 1, &rawShaderCode_cstr, NULL);
     glCompileShader(ID);
+
+    // Querying the status waits for the compiler
+    isStatusPending = true;
+    if (compileMode == CompileMode::BLOCKING) {
+        checkCompileStatus();
+    }
+}
+
+void GLShader::checkCompileStatus() {
+    isStatusPending = false;
+    std::string typeString =
+        shaderType == ShaderType::FRAGMENT ? "fragment" : "vertex";
+
+    GLint success;
     glGetShaderiv(ID, GL_COMPILE_STATUS, &success);
 
     if (!success) {
@@ -159,6 +214,7 @@ void GLShader::destroyShader() {
 
     ID = 0;
     hasCompiled = false;
+    isStatusPending = false;
 }
 
 GLShader::~GLShader() {
@@ -3,15 +3,22 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <Basil/Packages/Context.hpp>
 #include <Basil/Packages/Logging.hpp>
 
+#include "GLShaderPreprocessor.hpp"
+
 namespace basil {
 
 /** @brief Container class for OpenGL shader. */
 class GLShader : private IBasilContextConsumer {
  public:
+    /** @brief Whether to wait for compilation when creating a shader,
+     *  or to compile in parallel and check the result when needed. */
+    enum class CompileMode { BLOCKING, PARALLEL };
+
     /** @return ID value assigned from OpenGL. */
     virtual GLuint getID() const { return ID; }
 
@@ -21,8 +28,26 @@ class GLShader : private IBasilContextConsumer {
     /** @brief Sets shader code from string, and compiles. */
     virtual void setShader(const std::string& shaderCode) = 0;
 
-    /** @returns Boolean indicating if code has compiled. */
-    bool hasCompiledSuccessfully() { return hasCompiled; }
+    /** @returns Boolean indicating if code has compiled. Waits for
+     *  compilation to finish if compiling in parallel. */
+    bool hasCompiledSuccessfully();
+
+    /** @returns Whether compilation has finished, so that checking
+     *  the result will not block. */
+    bool isCompileComplete();
+
+    /** @returns Code passed to the compiler. */
+    const std::string& getShaderCode() const { return rawShaderCode; }
+
+    /** @returns Files read to build the shader, i.e. the source file
+     *  and its includes. Empty if built from code. */
+    const std::vector<std::filesystem::path>& getDependencies() const {
+        return dependencies;
+    }
+
+    /** @returns Whether the driver can compile shaders in parallel,
+     *  using GL_KHR_parallel_shader_compile. */
+    static bool supportsParallelCompile();
 
     /** @brief Destructor, tears down OpenGL shader code. */
     ~GLShader();
@@ -34,7 +59,11 @@ class GLShader : private IBasilContextConsumer {
     enum ShaderType { FRAGMENT, VERTEX };
 
     GLShader() = default;
-    GLShader(std::filesystem::path path, ShaderType type);
+    GLShader(std::filesystem::path path, ShaderType type,
+        CompileMode mode = CompileMode::BLOCKING,
+        const GLShaderDefines& defines = {});
+    GLShader(const GLShaderSource& source, ShaderType type,
+        CompileMode mode);
     GLShader(const std::string &shaderCode, ShaderType type);
 
     void setShaderWithType(std::filesystem::path path, ShaderType type);
@@ -44,14 +73,13 @@ class GLShader : private IBasilContextConsumer {
 
     GLuint ID = 0;
 
+    // Generates a triangle covering the viewport, without attributes
     static inline const std::string NO_OP_VERTEX_CODE =
         "#version 450 core\n"
-        "layout (location = 0) in vec3 aPos;\n"
-        "layout (location = 1) in vec2 aTexCoord;\n"
         "out vec2 TexCoord;\n"
         "void main() {\n"
-        "gl_Position = vec4(aPos, 1.0);\n"
-        "TexCoord = aTexCoord; }";
+        "TexCoord = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+        "gl_Position = vec4(TexCoord * 2.0 - 1.0, 0.0, 1.0); }";
 
     static inline const std::string DEBUG_FRAGMENT_CODE =
         "#version 450 core\n"
@@ -85,16 +113,20 @@ class GLShader : private IBasilContextConsumer {
     Logger& logger = Logger::get();
 
     bool hasCompiled = false;
+    bool isStatusPending = false;
+    CompileMode compileMode = CompileMode::BLOCKING;
+    ShaderType shaderType = ShaderType::FRAGMENT;
 
     std::string rawShaderCode;
+    std::vector<std::filesystem::path> dependencies;
 
-    void getShaderFromFile(std::filesystem::path path);
+    void getShaderFromFile(std::filesystem::path path,
+        const GLShaderDefines& defines = {});
+    void getShaderFromSource(const GLShaderSource& source);
     void getShaderFromString(const std::string &shaderCode);
     void compileShader(ShaderType type);
+    void checkCompileStatus();
 
-    LOGGER_FORMAT LOG_READ_FAILURE =
-        "Unable to read shader file at path {} "
-        "See error message:";
     LOGGER_FORMAT LOG_READ_SUCCESS =
         "Shader file read successfully.";
 
@@ -116,12 +148,22 @@ class GLVertexShader : public GLShader {
     /** @brief Default constructor. Does not compile shader. */
     GLVertexShader() = default;
 
-    /** @brief Pass-through vertex shader. */
+    /** @brief Pass-through vertex shader, drawing a fullscreen triangle
+     *  without vertex attributes. Shared through GLResourceRegistry. */
     static std::shared_ptr<GLVertexShader> noOpShader();
 
     /** @brief Create vertex shader from file at path. */
     explicit GLVertexShader(std::filesystem::path path);
 
+    /** @brief Create vertex shader from file at path, with defines
+     *  injected by GLShaderPreprocessor. */
+    GLVertexShader(std::filesystem::path path, CompileMode mode,
+        const GLShaderDefines& defines = {});
+
+    /** @brief Create vertex shader from preprocessed source. */
+    explicit GLVertexShader(const GLShaderSource& source,
+        CompileMode mode = CompileMode::BLOCKING);
+
     /** @brief Create vertex shader from shader code. */
     explicit GLVertexShader(const std::string &shaderCode);
 
@@ -138,12 +180,23 @@ class GLFragmentShader : public GLShader {
     /** @brief Default constructor. Does not compile shader. */
     GLFragmentShader() = default;
 
-    /** @brief Debug pattern fragment shader. */
+    /** @brief Debug pattern fragment shader. Shared through
+     *  GLResourceRegistry. */
     static std::shared_ptr<GLFragmentShader> debugShader();
 
     /** @brief Create fragment shader from file at path. */
     explicit GLFragmentShader(std::filesystem::path path);
 
+    /** @brief Create fragment shader from file at path, with defines
+     *  injected by GLShaderPreprocessor. In PARALLEL mode, the compile
+     *  result is only checked once requested. */
+    GLFragmentShader(std::filesystem::path path, CompileMode mode,
+        const GLShaderDefines& defines = {});
+
+    /** @brief Create fragment shader from preprocessed source. */
+    explicit GLFragmentShader(const GLShaderSource& source,
+        CompileMode mode = CompileMode::BLOCKING);
+
     /** @brief Create fragment shader from shader code. */
     explicit GLFragmentShader(const std::string &shaderCode);
 
@@ -1,13 +1,15 @@
 #include <utility>
 
 #include "GLShaderPane.hpp"
+#include "GLResourceRegistry.hpp"
+#include "GLShaderPermutationCache.hpp"
+#include "GLStateCache.hpp"
 
 namespace basil {
 
 void GLShaderPane::setupGLBuffers() {
-    // Set up OpenGL
-    createVertexObjects();
-    createElementBuffer();
+    // Vertex array is shared by every pane
+    screenGeometry = GLResourceRegistry::get().getScreenGeometry();
 }
 
 void GLShaderPane::setShaderProgram(
@@ -25,49 +27,9 @@ void GLShaderPane::setShaderProgram(
     this->IDataPublisher::subscribe(this->currentShaderProgram);
 }
 
-void GLShaderPane::createVertexObjects() {
-    // Create Vertex Attribute Object
-    glGenVertexArrays(1, &vertexAttributeID);
-    glBindVertexArray(vertexAttributeID);
-
-    // Copy vertices of unit quad into buffer
-    float vertices[] = {
-         // Position              // UV coordinates
-         1.0f,  1.0f,  0.0f,      1.0f,  1.0f,  // Top    right
-         1.0f, -1.0f,  0.0f,      1.0f,  0.0f,  // Bottom right
-        -1.0f, -1.0f,  0.0f,      0.0f,  0.0f,  // Bottom left
-        -1.0f,  1.0f,  0.0f,      0.0f,  1.0f   // Top    left
-    };
-    glGenBuffers(1, &vertexBufferID);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    // Set up vertex attributes
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
-        5 * sizeof(float),
-        reinterpret_cast<void*>(0));
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE,
-        5 * sizeof(float),
-        reinterpret_cast<void*>(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-}
-
-void GLShaderPane::createElementBuffer() {
-    // Copy indices into element buffer
-    unsigned int indices[] = {
-        0, 1, 3,
-        1, 2, 3,
-    };
-    glGenBuffers(1, &elementBufferID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBufferID);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-        sizeof(indices), indices, GL_STATIC_DRAW);
-}
-
 void GLShaderPane::draw() {
     // Set current viewport
-    glViewport(
+    GLStateCache::get().setViewport(
         viewArea.xOffset,
         viewArea.yOffset,
         viewArea.width,
@@ -78,26 +40,18 @@ void GLShaderPane::draw() {
         currentShaderProgram->use();
     }
 
-    // Render quad of triangles
-    glBindVertexArray(vertexAttributeID);
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-}
-
-GLShaderPane::~GLShaderPane() {
-    GLuint vertexArrays[] = { vertexAttributeID };
-    glDeleteVertexArrays(1, vertexArrays);
-
-    GLuint bufferArrays[] = { elementBufferID, vertexBufferID };
-    glDeleteBuffers(2, bufferArrays);
+    // Render quad, or fullscreen triangle for attributeless shaders
+    if (screenGeometry) {
+        screenGeometry->draw(!currentShaderProgram
+            || currentShaderProgram->hasVertexAttributes());
+    }
 }
 
 GLShaderPane::Builder&
 GLShaderPane::Builder::fromShader(
         std::shared_ptr<GLFragmentShader> fragmentShader) {
-    auto shaderProgram = GLShaderProgram::Builder()
-        .withFragmentShader(fragmentShader)
-        .withDefaultVertexShader()
-        .build();
+    auto shaderProgram = std::make_shared<GLShaderProgram>(
+        GLVertexShader::noOpShader(), fragmentShader);
     impl->setShaderProgram(std::move(shaderProgram));
     return (*this);
 }
@@ -105,10 +59,9 @@ GLShaderPane::Builder::fromShader(
 GLShaderPane::Builder&
 GLShaderPane::Builder::fromShaderFile(
         std::filesystem::path filePath) {
-    auto shaderProgram = GLShaderProgram::Builder()
-        .withFragmentShader(std::make_shared<GLFragmentShader>(filePath))
-        .withDefaultVertexShader()
-        .build();
+    auto shaderProgram = std::make_shared<GLShaderProgram>(
+        GLVertexShader::noOpShader(),
+        GLShaderPermutationCache::get().getFragmentShader(filePath));
     impl->setShaderProgram(std::move(shaderProgram));
     return (*this);
 }
@@ -116,10 +69,9 @@ GLShaderPane::Builder::fromShaderFile(
 GLShaderPane::Builder&
 GLShaderPane::Builder::fromShaderCode(
         const std::string& shaderCode) {
-    auto shaderProgram = GLShaderProgram::Builder()
-        .withFragmentShader(std::make_shared<GLFragmentShader>(shaderCode))
-        .withDefaultVertexShader()
-        .build();
+    auto shaderProgram = std::make_shared<GLShaderProgram>(
+        GLVertexShader::noOpShader(),
+        GLResourceRegistry::get().getFragmentShader(shaderCode));
     impl->setShaderProgram(std::move(shaderProgram));
     return (*this);
 }
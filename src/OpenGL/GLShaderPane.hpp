@@ -9,6 +9,7 @@
 
 #include "Window/IPane.hpp"
 
+#include "GLScreenGeometry.hpp"
 #include "GLShader.hpp"
 #include "GLShaderProgram.hpp"
 
@@ -37,15 +38,15 @@ class GLShaderPane :  public IPane,
     /** @brief Creates blank GLShaderPane. */
     GLShaderPane() = default;
 
-    /** @brief Destructor unbinds OpenGL-allocated memory. */
-    ~GLShaderPane();
-
     /** @brief Set shader program in use. */
     void setShaderProgram(std::shared_ptr<GLShaderProgram> shaderProgram);
 
     /** @brief Draws to screen using shader and texture(s). */
     void draw() override;
 
+    /** @brief Builder pattern for GLShaderPane. Panes built from the
+     *  same fragment shader share the compiled shader, but each links
+     *  its own program, so that each keeps uniforms of its own. */
     class Builder : public IBuilder<GLShaderPane> {
      public:
         /** @brief Creates pane from GLFragmentShader object. */
@@ -70,12 +71,8 @@ class GLShaderPane :  public IPane,
  protected:
 #endif
     void setupGLBuffers();
-    void createVertexObjects();
-    void createElementBuffer();
 
-    GLuint vertexAttributeID = 0;
-    GLuint vertexBufferID = 0;
-    GLuint elementBufferID = 0;
+    std::shared_ptr<GLScreenGeometry> screenGeometry = nullptr;
     std::shared_ptr<GLShaderProgram> currentShaderProgram = nullptr;
 };
 
@@ -0,0 +1,72 @@
+#include <fmt/format.h>
+
+#include <optional>
+
+#include "GLShaderPermutationCache.hpp"
+
+namespace basil {
+
+template<class T>
+std::shared_ptr<T> GLShaderPermutationCache::getShader(
+        ShaderMap<T>& shaders,
+        const std::filesystem::path& path,
+        const GLShaderDefines& defines,
+        GLShader::CompileMode mode) {
+    std::optional<GLShaderSource> source =
+        GLShaderPreprocessor(defines).processFile(path);
+
+    // Build uncached shader, which reports the failure like any other
+    if (!source.has_value()) {
+        return std::make_shared<T>(path, mode, defines);
+    }
+
+    // Keyed by root file too, as equal code from another file has
+    // other dependencies to watch
+    Key key = { source->dependencies.front(), source->sourceHash, defines };
+    if (auto found = shaders.find(key); found != shaders.end()) {
+        auto shader = found->second.shader.lock();
+        if (shader && found->second.code == source->code
+                && shader->getDependencies() == source->dependencies) {
+            logger.log(
+                fmt::format(LOG_CACHE_HIT, path.string()),
+                LogLevel::DEBUG);
+            return shader;
+        }
+    }
+
+    std::erase_if(shaders, [](const auto& entry) {
+        return entry.second.shader.expired();
+    });
+
+    auto shader = std::make_shared<T>(source.value(), mode);
+    shaders[key] = Entry<T> { shader, source->code };
+    return shader;
+}
+
+std::shared_ptr<GLFragmentShader>
+GLShaderPermutationCache::getFragmentShader(
+        const std::filesystem::path& path,
+        const GLShaderDefines& defines,
+        GLShader::CompileMode mode) {
+    return getShader(fragmentShaders, path, defines, mode);
+}
+
+std::shared_ptr<GLVertexShader> GLShaderPermutationCache::getVertexShader(
+        const std::filesystem::path& path,
+        const GLShaderDefines& defines,
+        GLShader::CompileMode mode) {
+    return getShader(vertexShaders, path, defines, mode);
+}
+
+std::size_t GLShaderPermutationCache::getSize() const {
+    std::size_t size = 0;
+    for (const auto& [key, entry] : fragmentShaders) {
+        size += !entry.shader.expired();
+    }
+    for (const auto& [key, entry] : vertexShaders) {
+        size += !entry.shader.expired();
+    }
+    return size;
+}
+
+}  // namespace basil
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include <Basil/Packages/Logging.hpp>
+
+#include "GLShader.hpp"
+#include "GLShaderPreprocessor.hpp"
+
+namespace basil {
+
+/** @brief Cache of compiled shader variants, using Singleton pattern.
+ *  Variants are keyed by their root file, by the hash of their
+ *  preprocessed source and by their defines, so that each variant is
+ *  compiled once, however many programs use it. Code and dependencies
+ *  are compared on a hit, so that colliding variants are not shared.
+ *  Shaders are held weakly, and are deleted once no program uses them. */
+class GLShaderPermutationCache {
+ public:
+    /** @return Instance of Singleton cache. */
+    static GLShaderPermutationCache& get() {
+        static GLShaderPermutationCache instance;
+        return instance;
+    }
+
+    /** @returns Fragment shader built from file with defines, compiling
+     *  it only if no such variant is already in use. */
+    std::shared_ptr<GLFragmentShader> getFragmentShader(
+        const std::filesystem::path& path,
+        const GLShaderDefines& defines = {},
+        GLShader::CompileMode mode = GLShader::CompileMode::BLOCKING);
+
+    /** @returns Vertex shader built from file with defines, compiling
+     *  it only if no such variant is already in use. */
+    std::shared_ptr<GLVertexShader> getVertexShader(
+        const std::filesystem::path& path,
+        const GLShaderDefines& defines = {},
+        GLShader::CompileMode mode = GLShader::CompileMode::BLOCKING);
+
+    /** @returns Number of cached variants still in use. */
+    std::size_t getSize() const;
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    using Key =
+        std::tuple<std::filesystem::path, std::size_t, GLShaderDefines>;
+
+    /** @brief Cached variant, with the code it was built from, which
+     *  may differ from the code it compiled, e.g. for ShaderToy files */
+    template<class T>
+    struct Entry {
+        std::weak_ptr<T> shader;
+        std::string code;
+    };
+
+    template<class T>
+    using ShaderMap = std::map<Key, Entry<T>>;
+
+    GLShaderPermutationCache() = default;
+
+    template<class T>
+    std::shared_ptr<T> getShader(ShaderMap<T>& shaders,
+        const std::filesystem::path& path,
+        const GLShaderDefines& defines,
+        GLShader::CompileMode mode);
+
+    Logger& logger = Logger::get();
+
+    ShaderMap<GLFragmentShader> fragmentShaders;
+    ShaderMap<GLVertexShader> vertexShaders;
+
+    LOGGER_FORMAT LOG_CACHE_HIT =
+        "Shader cache - Reusing compiled variant of {}.";
+};
+
+}   // namespace basil
@@ -0,0 +1,236 @@
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <regex>
+#include <sstream>
+#include <string_view>
+
+#include "GLShaderPreprocessor.hpp"
+
+namespace basil {
+
+void GLShaderPreprocessor::setDefine(
+        const std::string& name, const std::string& value) {
+    defines[name] = value;
+}
+
+void GLShaderPreprocessor::addIncludeDirectory(
+        const std::filesystem::path& directory) {
+    includeDirectories.push_back(directory);
+}
+
+std::optional<GLShaderSource> GLShaderPreprocessor::processFile(
+        const std::filesystem::path& path) const {
+    ExpansionState state;
+    if (!expandFile(path, state)) return std::nullopt;
+
+    GLShaderSource& source = state.source;
+    source.sourceHash = std::hash<std::string>{}(source.code);
+    injectDefines(source.code);
+
+    return source;
+}
+
+bool GLShaderPreprocessor::expandFile(const std::filesystem::path& path,
+        ExpansionState& state) const {
+    auto absolutePath = std::filesystem::absolute(path).lexically_normal();
+    if (state.includedOnce.contains(absolutePath)) return true;
+
+    auto& stack = state.includeStack;
+    if (std::find(stack.begin(), stack.end(), absolutePath) != stack.end()) {
+        logger.log(
+            fmt::format(LOG_INCLUDE_RECURSIVE, absolutePath.string()),
+            LogLevel::ERROR);
+        return false;
+    }
+
+    std::optional<std::string> code = readFile(absolutePath);
+    if (!code.has_value()) {
+        logger.log(
+            fmt::format(LOG_READ_FAILURE, path.string()),
+            LogLevel::ERROR);
+        return false;
+    }
+
+    // Source string numbers index the dependency list
+    int sourceNumber = state.source.dependencies.size();
+    state.source.dependencies.push_back(absolutePath);
+    if (sourceNumber > 0) {
+        state.source.code += fmt::format("#line 1 {}\n", sourceNumber);
+    }
+
+    stack.push_back(absolutePath);
+    bool isExpanded = expandCode(
+        code.value(), absolutePath.parent_path(), sourceNumber, state);
+    stack.pop_back();
+
+    return isExpanded;
+}
+
+bool GLShaderPreprocessor::expandCode(const std::string& code,
+        const std::filesystem::path& directory,
+        int sourceNumber, ExpansionState& state) const {
+    std::string& output = state.source.code;
+
+    std::size_t start = 0;
+    int lineNumber = 0;
+    while (start < code.size()) {
+        std::size_t end = code.find('\n', start);
+        bool hasNewline = end != std::string::npos;
+        if (!hasNewline) end = code.size();
+
+        std::string line = code.substr(start, end - start);
+        start = hasNewline ? end + 1 : end;
+        lineNumber++;
+
+        std::string directive = line;
+        std::erase_if(directive,
+            [](unsigned char c) { return std::isspace(c); });
+
+        if (directive == "#pragmaonce") {
+            // Keep an empty line, so that line numbers are unchanged
+            if (!state.includeStack.empty()) {
+                state.includedOnce.insert(state.includeStack.back());
+            }
+            if (hasNewline) output += '\n';
+            continue;
+        }
+
+        if (!directive.starts_with("#include")) {
+            output += line;
+            if (hasNewline) output += '\n';
+            continue;
+        }
+
+        std::optional<std::string> name = getIncludeName(line);
+        if (!name.has_value()) {
+            logger.log(
+                fmt::format(LOG_INCLUDE_INVALID, line),
+                LogLevel::ERROR);
+            return false;
+        }
+
+        std::optional<std::filesystem::path> includePath =
+            resolveInclude(name.value(), directory);
+        if (!includePath.has_value()) {
+            logger.log(
+                fmt::format(LOG_INCLUDE_FAILURE,
+                    name.value(), directory.string()),
+                LogLevel::ERROR);
+            return false;
+        }
+
+        if (!expandFile(includePath.value(), state)) return false;
+
+        // Return to the line after the include in this file
+        if (!output.empty() && output.back() != '\n') output += '\n';
+        output += fmt::format("#line {} {}\n", lineNumber + 1, sourceNumber);
+    }
+
+    return true;
+}
+
+std::optional<std::filesystem::path> GLShaderPreprocessor::resolveInclude(
+        const std::string& name,
+        const std::filesystem::path& directory) const {
+    std::vector<std::filesystem::path> searchDirectories = { directory };
+    searchDirectories.insert(searchDirectories.end(),
+        includeDirectories.begin(), includeDirectories.end());
+
+    for (const auto& searchDirectory : searchDirectories) {
+        auto path = (searchDirectory / name).lexically_normal();
+
+        std::error_code error;
+        if (std::filesystem::is_regular_file(path, error)) {
+            return path;
+        }
+    }
+    return std::nullopt;
+}
+
+void GLShaderPreprocessor::injectDefines(std::string& code) const {
+    if (defines.empty()) return;
+
+    std::string block;
+    for (const auto& [name, value] : defines) {
+        block += value.empty()
+            ? fmt::format("#define {}\n", name)
+            : fmt::format("#define {} {}\n", name, value);
+    }
+
+    // Defines must follow #version, which must come before anything else
+    std::size_t start = 0;
+    int lineNumber = 0;
+    while (start < code.size()) {
+        std::size_t end = code.find('\n', start);
+        lineNumber++;
+
+        std::string_view line(code.data() + start,
+            (end == std::string::npos ? code.size() : end) - start);
+        line.remove_prefix(std::min(
+            line.find_first_not_of(" \t"), line.size()));
+
+        if (line.starts_with("#version")) {
+            if (end == std::string::npos) {
+                code += '\n';
+                end = code.size() - 1;
+            }
+            block += fmt::format("#line {} 0\n", lineNumber + 1);
+            code.insert(end + 1, block);
+            return;
+        }
+
+        if (end == std::string::npos) break;
+        start = end + 1;
+    }
+
+    code = block + "#line 1 0\n" + code;
+}
+
+unsigned int GLShaderPreprocessor::freezeUniforms(std::string& code,
+        const std::map<std::string, std::string>& values) {
+    unsigned int count = 0;
+    for (const auto& [name, value] : values) {
+        // Matches e.g. "layout(location = 2) uniform vec2 name = vec2(1.);"
+        std::regex declaration(
+            R"((layout\s*\([^)]*\)\s*)?uniform\s+(\w+)\s+)" + name
+            + R"(\s*(=[^;]*)?;)");
+        if (!std::regex_search(code, declaration)) continue;
+
+        code = std::regex_replace(code, declaration,
+            fmt::format("const $2 {} = $2({});", name, value));
+        count++;
+    }
+    return count;
+}
+
+std::optional<std::string> GLShaderPreprocessor::readFile(
+        const std::filesystem::path& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) return std::nullopt;
+
+    std::stringstream stream;
+    stream << file.rdbuf();
+    if (file.bad()) return std::nullopt;
+
+    return stream.str();
+}
+
+std::optional<std::string> GLShaderPreprocessor::getIncludeName(
+        const std::string& line) {
+    std::size_t open = line.find_first_of("\"<", line.find("include"));
+    if (open == std::string::npos) return std::nullopt;
+
+    char closingChar = line[open] == '<' ? '>' : '"';
+    std::size_t close = line.find(closingChar, open + 1);
+    if (close == std::string::npos || close == open + 1) {
+        return std::nullopt;
+    }
+
+    return line.substr(open + 1, close - open - 1);
+}
+
+}  // namespace basil
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <Basil/Packages/Logging.hpp>
+
+namespace basil {
+
+/** @brief Preprocessor definitions injected into shader source,
+ *  mapping name to value. An empty value defines the name only. */
+using GLShaderDefines = std::map<std::string, std::string>;
+
+/** @brief Shader source after preprocessing. */
+struct GLShaderSource {
+    /** @brief Expanded code, with injected defines. */
+    std::string code;
+
+    /** @brief Hash of expanded code, before defines are injected. */
+    std::size_t sourceHash = 0;
+
+    /** @brief Every file read, starting with the root file. Index into
+     *  this list is the source string number used by #line directives,
+     *  so that compile errors can be mapped back to files. */
+    std::vector<std::filesystem::path> dependencies;
+};
+
+/** @brief Expands GLSL source before compilation. Resolves #include
+ *  directives, relative to the including file and then to any include
+ *  directories, honoring #pragma once. Injects #define directives after
+ *  the #version directive, and emits #line directives so that compile
+ *  errors refer to the original files and lines. */
+class GLShaderPreprocessor {
+ public:
+    /** @brief Preprocessor without defines. */
+    GLShaderPreprocessor() = default;
+
+    /** @brief Preprocessor which injects the given defines. */
+    explicit GLShaderPreprocessor(const GLShaderDefines& defines)
+        : defines(defines) {}
+
+    /** @brief Define name with value, replacing any previous value. */
+    void setDefine(const std::string& name, const std::string& value = "");
+
+    /** @returns Defines injected into processed source. */
+    const GLShaderDefines& getDefines() const { return defines; }
+
+    /** @brief Search directory for includes which are not found
+     *  relative to the including file. */
+    void addIncludeDirectory(const std::filesystem::path& directory);
+
+    /** @brief Read and expand file at path.
+     *  @returns Expanded source, or nullopt if any file could not be
+     *  read or includes are recursive. */
+    std::optional<GLShaderSource> processFile(
+        const std::filesystem::path& path) const;
+
+    /** @brief Rewrites declarations of uniforms into constants, so that
+     *  the compiler can fold them, e.g. to unroll loops.
+     *  @param code     Shader code to rewrite in place
+     *  @param values   Comma-separated constructor arguments by uniform
+     *                  name, e.g. "1.0, 0.5" for a vec2
+     *  @returns Number of uniform declarations rewritten */
+    static unsigned int freezeUniforms(std::string& code,
+        const std::map<std::string, std::string>& values);
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    struct ExpansionState {
+        GLShaderSource source;
+        std::vector<std::filesystem::path> includeStack;
+        std::set<std::filesystem::path> includedOnce;
+    };
+
+    bool expandFile(const std::filesystem::path& path,
+        ExpansionState& state) const;
+    bool expandCode(const std::string& code,
+        const std::filesystem::path& directory,
+        int sourceNumber, ExpansionState& state) const;
+
+    std::optional<std::filesystem::path> resolveInclude(
+        const std::string& name,
+        const std::filesystem::path& directory) const;
+
+    void injectDefines(std::string& code) const;
+
+    static std::optional<std::string> readFile(
+        const std::filesystem::path& path);
+    static std::optional<std::string> getIncludeName(
+        const std::string& line);
+
+    Logger& logger = Logger::get();
+
+    GLShaderDefines defines;
+    std::vector<std::filesystem::path> includeDirectories;
+
+    LOGGER_FORMAT LOG_READ_FAILURE =
+        "Unable to read shader file at path {}";
+    LOGGER_FORMAT LOG_INCLUDE_FAILURE =
+        "Shader preprocessor - Unable to find include \"{}\" in {}";
+    LOGGER_FORMAT LOG_INCLUDE_INVALID =
+        "Shader preprocessor - Invalid include directive \"{}\"";
+    LOGGER_FORMAT LOG_INCLUDE_RECURSIVE =
+        "Shader preprocessor - Recursive include of {}";
+};
+
+}   // namespace basil
@@ -1,6 +1,13 @@
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
 #include "GLShaderProgram.hpp"
+#include "GLProgramBinaryCache.hpp"
+#include "GLShaderPermutationCache.hpp"
+#include "GLStateCache.hpp"
 
 #include "Data/ShaderUniformModel.hpp"
 #include "File/FileTextureSource.hpp"
@@ -15,6 +22,16 @@ GLShaderProgram::GLShaderProgram(
     this->compile();
 }
 
+GLShaderProgram::GLShaderProgram(
+    std::shared_ptr<GLVertexShader> vertexShader,
+    std::shared_ptr<GLFragmentShader> fragmentShader,
+    GLShader::CompileMode mode):
+        vertexShader(vertexShader),
+        fragmentShader(fragmentShader),
+        compileMode(mode) {
+    this->compile();
+}
+
 void GLShaderProgram::compile() {
     if (!vertexShader || !fragmentShader) return;
 
@@ -26,7 +43,50 @@ void GLShaderProgram::compile() {
         uniformManager.setProgramID(ID);
     }
 
+    // Link from cached binary where possible, otherwise from source
+    auto& binaryCache = GLProgramBinaryCache::get();
+    isLoadedFromBinary = binaryCache.isEnabled() && binaryCache.load(ID,
+        vertexShader->getShaderCode(), fragmentShader->getShaderCode());
+
+    if (isLoadedFromBinary) {
+        isStatusPending = true;
+        checkLinkStatus();
+        return;
+    }
+
+    if (binaryCache.isEnabled()) {
+        glProgramParameteri(ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    linkStartTime = FrameClock::now();
     glLinkProgram(ID);
+
+    // Querying the status waits for the linker
+    isStatusPending = true;
+    if (compileMode == GLShader::CompileMode::BLOCKING) {
+        checkLinkStatus();
+    }
+}
+
+bool GLShaderProgram::hasLinkedSuccessfully() {
+    if (isStatusPending) {
+        checkLinkStatus();
+    }
+    return hasLinked;
+}
+
+bool GLShaderProgram::isLinkComplete() {
+    if (!isStatusPending || !GLShader::supportsParallelCompile()) {
+        return true;
+    }
+
+    GLint isComplete = GL_FALSE;
+    glGetProgramiv(ID, GL_COMPLETION_STATUS_KHR, &isComplete);
+    return isComplete == GL_TRUE;
+}
+
+void GLShaderProgram::checkLinkStatus() {
+    isStatusPending = false;
+
     int success;
     glGetProgramiv(ID, GL_LINK_STATUS, &success);
 
@@ -42,19 +102,199 @@ void GLShaderProgram::compile() {
             LogLevel::ERROR);
 
         hasLinked = false;
+        uniformManager.clearUniformTable();
     } else {
         logger.log(
             fmt::format(LOG_LINK_SUCCESS, ID),
             LogLevel::INFO);
         hasLinked = true;
 
+        // Locations and block bindings may change on every link
+        uniformManager.loadUniformTable();
+        loadVertexAttributes();
+        for (auto& [blockName, uniformBuffer] : uniformBuffers) {
+            uniformBuffer->attachProgram(ID);
+        }
+
         // Restore any previously-applied uniforms
         uniformManager.applyCachedUniforms();
+
+        auto& binaryCache = GLProgramBinaryCache::get();
+        if (!isLoadedFromBinary && binaryCache.isEnabled()) {
+            binaryCache.save(ID,
+                vertexShader->getShaderCode(),
+                fragmentShader->getShaderCode(),
+                FrameClock::now() - linkStartTime);
+        }
+    }
+}
+
+void GLShaderProgram::loadVertexAttributes() {
+    GLint inputCount = 0;
+    glGetProgramInterfaceiv(ID, GL_PROGRAM_INPUT,
+        GL_ACTIVE_RESOURCES, &inputCount);
+
+    // Built-in inputs such as gl_VertexID have no location
+    hasAttributes = false;
+    for (GLint index = 0; index < inputCount && !hasAttributes; index++) {
+        const GLenum property = GL_LOCATION;
+        GLint location = -1;
+        glGetProgramResourceiv(ID, GL_PROGRAM_INPUT, index,
+            1, &property, 1, NULL, &location);
+        hasAttributes = location >= 0;
     }
 }
 
 void GLShaderProgram::use() {
-    glUseProgram(ID);
+    if (isStatusPending) {
+        checkLinkStatus();
+    }
+
+    if (!frozenUniforms.empty()) {
+        updateSpecialization();
+    }
+
+    for (auto& [blockName, uniformBuffer] : uniformBuffers) {
+        uniformBuffer->commit();
+    }
+
+    if (specializedProgram) {
+        specializedProgram->uniformManager.bindStorageBuffers();
+        specializedProgram->uniformManager.bindTextures();
+        GLStateCache::get().useProgram(specializedProgram->ID);
+        return;
+    }
+
+    uniformManager.bindStorageBuffers();
+    uniformManager.bindTextures();
+    GLStateCache::get().useProgram(ID);
+}
+
+void GLShaderProgram::setUniform(std::shared_ptr<GLUniform> uniform) {
+    uniformManager.setUniform(uniform);
+
+    if (specializedProgram) {
+        specializedProgram->uniformManager.setUniform(uniform);
+    }
+}
+
+void GLShaderProgram::freezeUniform(const std::string& name) {
+    frozenUniforms.insert(name);
+    resetSpecialization();
+}
+
+void GLShaderProgram::updateSpecialization() {
+    // Swap in specialized program once linked, without waiting for it
+    if (pendingSpecialization && pendingSpecialization->isLinkComplete()) {
+        if (pendingSpecialization->hasLinkedSuccessfully()) {
+            pendingSpecialization->copyUniformsFrom(*this);
+            specializedProgram = std::move(pendingSpecialization);
+        } else {
+            logger.log(
+                fmt::format(LOG_SPECIALIZE_FAILURE, ID),
+                LogLevel::WARN);
+        }
+        pendingSpecialization = nullptr;
+    }
+
+    // Compare raw values, as uniforms may point to external data
+    bool hasChanged = false;
+    std::size_t valueCount = 0;
+    const auto& cachedUniforms = uniformManager.getCachedUniforms();
+    for (const auto& name : frozenUniforms) {
+        auto found = cachedUniforms.find(name);
+        if (found == cachedUniforms.end()) continue;
+
+        auto frozen = frozenValues.find(name);
+        auto data = static_cast<std::byte*>(found->second->getData());
+        hasChanged |= frozen == frozenValues.end()
+            || !std::equal(frozen->second.begin(), frozen->second.end(),
+                data, data + found->second->getDataSize());
+        valueCount++;
+    }
+
+    if (!hasChanged && valueCount == frozenValues.size()) return;
+
+    // Constants of the specialized program are now stale
+    frozenValues.clear();
+    for (const auto& name : frozenUniforms) {
+        auto found = cachedUniforms.find(name);
+        if (found == cachedUniforms.end()) continue;
+
+        auto data = static_cast<std::byte*>(found->second->getData());
+        frozenValues[name].assign(
+            data, data + found->second->getDataSize());
+    }
+
+    specializedProgram = nullptr;
+    specialize();
+}
+
+void GLShaderProgram::specialize() {
+    pendingSpecialization = nullptr;
+    if (!vertexShader || !fragmentShader) return;
+
+    std::map<std::string, std::string> constants;
+    const auto& cachedUniforms = uniformManager.getCachedUniforms();
+    for (const auto& [name, data] : frozenValues) {
+        auto values = getConstantValues(*cachedUniforms.at(name));
+        if (values.has_value()) {
+            constants[name] = values.value();
+        }
+    }
+
+    std::string code = fragmentShader->getShaderCode();
+    unsigned int count = GLShaderPreprocessor::freezeUniforms(code, constants);
+    if (count == 0) return;
+
+    logger.log(
+        fmt::format(LOG_SPECIALIZE, ID, count),
+        LogLevel::INFO);
+
+    auto source = GLShaderSource { .code = code };
+    pendingSpecialization = std::make_shared<GLShaderProgram>(
+        vertexShader,
+        std::make_shared<GLFragmentShader>(
+            source, GLShader::CompileMode::PARALLEL),
+        GLShader::CompileMode::PARALLEL);
+}
+
+void GLShaderProgram::resetSpecialization() {
+    frozenValues.clear();
+    specializedProgram = nullptr;
+    pendingSpecialization = nullptr;
+}
+
+std::optional<std::string> GLShaderProgram::getConstantValues(
+        const GLUniform& uniform) {
+    if (uniform.getCount() != 1) return std::nullopt;
+
+    unsigned int size = uniform.getLength() * uniform.getWidth();
+    auto toValues = [size](const auto& source) -> std::optional<std::string> {
+        using T = std::remove_pointer_t<decltype(source.data())>;
+
+        std::string values;
+        for (unsigned int i = 0; i < size; i++) {
+            T value = source.data()[i];
+            std::string literal = fmt::format("{}", value);
+
+            if constexpr (std::is_floating_point_v<T>) {
+                if (!std::isfinite(value)) return std::nullopt;
+
+                // Mark as floating point, and keep precision of doubles
+                if (literal.find_first_of(".e") == std::string::npos) {
+                    literal += ".0";
+                }
+                if constexpr (std::is_same_v<T, double>) {
+                    literal += "lf";
+                }
+            }
+
+            values += i == 0 ? literal : ", " + literal;
+        }
+        return values;
+    };
+    return std::visit(toValues, uniform.getSource());
 }
 
 void GLShaderProgram::setVertexShader(
@@ -67,6 +307,7 @@ void GLShaderProgram::setVertexShader(
     }
 
     vertexShader = setVertexShader;
+    resetSpecialization();
     compile();
 }
 
@@ -80,6 +321,7 @@ void GLShaderProgram::setFragmentShader(
     }
 
     fragmentShader = setFragmentShader;
+    resetSpecialization();
     compile();
 }
 
@@ -99,21 +341,86 @@ void GLShaderProgram::detachShader(GLint shaderID) {
 
 
 void GLShaderProgram::receiveData(const DataMessage& message) {
-    auto data = message.getData<ShaderUniformModel>();
-    if (!data.has_value()) return;
-    auto model = data.value();
-
-    auto uniforms = model.getUniforms();
+    if (auto delta = message.getDataPointer<ShaderUniformDelta>()) {
+        applyUniformDelta(*delta);
+        return;
+    }
 
-    for (auto pair : uniforms) {
-        auto uniform = pair.second;
+    if (auto model = message.getDataPointer<ShaderUniformModel>()) {
+        applyUniformDelta(model->getDelta(
+            getModelVersion(model->getModelID())));
+    }
+}
 
+void GLShaderProgram::copyUniformsFrom(const GLShaderProgram& other) {
+    for (const auto& [name, uniform] :
+            other.uniformManager.getCachedUniforms()) {
         uniformManager.setUniform(uniform);
     }
+
+    for (const auto& [blockName, uniformBuffer] : other.uniformBuffers) {
+        getUniformBuffer(blockName);
+    }
+
+    modelVersions = other.modelVersions;
+    frozenUniforms.insert(
+        other.frozenUniforms.begin(), other.frozenUniforms.end());
+}
+
+uint64_t GLShaderProgram::getModelVersion(unsigned int modelID) const {
+    auto found = modelVersions.find(modelID);
+    return found != modelVersions.end() ? found->second : 0;
+}
+
+void GLShaderProgram::applyUniformDelta(const ShaderUniformDelta& delta) {
+    std::shared_ptr<GLUniformBuffer> uniformBuffer =
+        getUniformBuffer(delta.blockName);
+
+    uniformBatch.clear();
+    for (const auto& uniform : delta.uniforms) {
+        if (uniformBuffer && uniformBuffer->setUniform(uniform)) continue;
+
+        uniformBatch.push_back(uniform);
+    }
+    uniformManager.setUniforms(uniformBatch);
+
+    if (specializedProgram) {
+        specializedProgram->uniformManager.setUniforms(uniformBatch);
+    }
+
+    // After a missed delta, keep the old version, so that the next full
+    // model sends the uniforms changed since, rather than leaving them
+    uint64_t modelVersion = getModelVersion(delta.modelID);
+    if (!delta.isComplete() && delta.baseVersion > modelVersion) {
+        logger.log(
+            fmt::format(LOG_DELTA_GAP, ID, delta.modelID,
+                delta.baseVersion, modelVersion),
+            LogLevel::WARN);
+        return;
+    }
+    modelVersions[delta.modelID] = delta.version;
+}
+
+std::shared_ptr<GLUniformBuffer> GLShaderProgram::getUniformBuffer(
+        const std::string& blockName) {
+    if (blockName.empty()) return nullptr;
+
+    if (uniformBuffers.contains(blockName)) {
+        return uniformBuffers.at(blockName);
+    }
+
+    auto uniformBuffer = GLUniformBuffer::forBlock(blockName);
+    if (hasLinkedSuccessfully() && uniformBuffer->attachProgram(ID)) {
+        uniformBuffers.emplace(blockName, uniformBuffer);
+        return uniformBuffer;
+    }
+
+    return nullptr;
 }
 
 void GLShaderProgram::destroyShaderProgram() {
     glDeleteProgram(ID);
+    GLStateCache::get().releaseProgram(ID);
 
     logger.log(
         fmt::format(LOG_DELETE, ID),
@@ -140,6 +447,15 @@ GLShaderProgram::Builder::withFragmentShaderFromFile(
     return (*this);
 }
 
+GLShaderProgram::Builder&
+GLShaderProgram::Builder::withFragmentShaderFromFile(
+        std::filesystem::path filePath,
+        const GLShaderDefines& defines) {
+    impl->setFragmentShader(GLShaderPermutationCache::get()
+        .getFragmentShader(filePath, defines));
+    return (*this);
+}
+
 GLShaderProgram::Builder&
 GLShaderProgram::Builder::withFragmentShaderFromCode(
         const std::string& shaderCode) {
@@ -163,6 +479,15 @@ GLShaderProgram::Builder::withVertexShaderFromFile(
     return (*this);
 }
 
+GLShaderProgram::Builder&
+GLShaderProgram::Builder::withVertexShaderFromFile(
+        std::filesystem::path filePath,
+        const GLShaderDefines& defines) {
+    impl->setVertexShader(GLShaderPermutationCache::get()
+        .getVertexShader(filePath, defines));
+    return (*this);
+}
+
 GLShaderProgram::Builder&
 GLShaderProgram::Builder::withVertexShaderFromCode(
         const std::string& shaderCode) {
@@ -171,6 +496,12 @@ GLShaderProgram::Builder::withVertexShaderFromCode(
     return (*this);
 }
 
+GLShaderProgram::Builder&
+GLShaderProgram::Builder::withFrozenUniform(const std::string& name) {
+    impl->freezeUniform(name);
+    return (*this);
+}
+
 GLShaderProgram::Builder&
 GLShaderProgram::Builder::withDefaultVertexShader() {
     impl->setVertexShader(GLVertexShader::noOpShader());
@@ -2,19 +2,25 @@
 
 #include <GL/glew.h>
 
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
 
 #include <Basil/Packages/Builder.hpp>
+#include <Basil/Packages/Chrono.hpp>
 #include <Basil/Packages/Context.hpp>
 #include <Basil/Packages/PubSub.hpp>
 
+#include "Data/ShaderUniformDelta.hpp"
+
 #include "GLProgramUniformManager.hpp"
 #include "GLShader.hpp"
 #include "GLUniform.hpp"
+#include "GLUniformBuffer.hpp"
 
 namespace basil {
 
@@ -34,10 +40,23 @@ class GLShaderProgram : public IDataSubscriber,
         std::shared_ptr<GLVertexShader> vertexShader,
         std::shared_ptr<GLFragmentShader> fragmentShader);
 
+    /** @brief Construct a new GLShaderProgram object. In PARALLEL mode,
+     *  linking is started but its result is only checked once requested,
+     *  so that the driver may link in the background.
+     *
+     * @param vertexShader    Shared_ptr to GLVertexShader object.
+     * @param fragmentShader  Shared_ptr to GLFragmentShader object.
+     * @param mode            Whether to wait for linking to finish. */
+    GLShaderProgram(
+        std::shared_ptr<GLVertexShader> vertexShader,
+        std::shared_ptr<GLFragmentShader> fragmentShader,
+        GLShader::CompileMode mode);
+
     /** @brief Deconstructor tears down OpenGL memory usage. */
     ~GLShaderProgram();
 
-    /** @brief Calls `glUseProgram` function to activate shader. */
+    /** @brief Commits changes to any uniform and storage buffers used
+     *  by the program, then calls `glUseProgram` to activate shader. */
     void use();
 
     /** @returns  OpenGL-ascribed ID of shader program. */
@@ -61,18 +80,63 @@ class GLShaderProgram : public IDataSubscriber,
         return fragmentShader;
     }
 
-    /** @returns Boolean indicating linking success. */
-    bool hasLinkedSuccessfully() { return hasLinked; }
+    /** @returns Boolean indicating linking success. Waits for linking
+     *  to finish if linking in parallel. */
+    bool hasLinkedSuccessfully();
+
+    /** @returns Whether compiling and linking have finished, so that
+     *  checking the result will not block. */
+    bool isLinkComplete();
+
+    /** @returns Whether the vertex shader reads vertex attributes, or
+     *  instead generates vertices, e.g. from gl_VertexID. */
+    bool hasVertexAttributes() const { return hasAttributes; }
+
+    /** @brief Applies the uniforms, uniform blocks and model versions
+     *  of another program, e.g. one this program replaces. */
+    void copyUniformsFrom(const GLShaderProgram& other);
 
     /** @brief Set uniform value in shader. */
-    void setUniform(std::shared_ptr<GLUniform> uniform) {
-        uniformManager.setUniform(uniform);
+    void setUniform(std::shared_ptr<GLUniform> uniform);
+
+    /** @brief Opt in to freezing a rarely-changing uniform of the
+     *  fragment shader. Once the uniform has a value, a program with the
+     *  uniform rewritten as a constant is compiled in the background,
+     *  and drawn in place of this program once linked. While it compiles,
+     *  e.g. after the value changes, this program is drawn instead.
+     *  Array uniforms and members of uniform blocks are not frozen. */
+    void freezeUniform(const std::string& name);
+
+    /** @returns Whether a program specialized on frozen uniforms is
+     *  drawn in place of this program. */
+    bool isSpecialized() const { return specializedProgram != nullptr; }
+
+    /** @returns Counts of uploaded and skipped uniform values. */
+    GLUniformUploadStats getUniformUploadStats() const {
+        return uniformManager.getUploadStats();
     }
 
-    /** @brief Updates shaders and textures from ShaderUniformModel object.
+    /** @brief Updates shaders and textures from ShaderUniformModel or
+     *  ShaderUniformDelta object. Uniforms of a model which have not
+     *  changed since it was last received are skipped.
      *  Overridden method from IDataSubscriber base class. */
     void receiveData(const DataMessage& message) override;
 
+    /** @brief Applies uniforms of delta, writing block members to the
+     *  shared uniform buffer and uploading the rest in one batch.
+     *  A partial delta based past the last applied version does not
+     *  advance it, so that the next full model covers the gap. */
+    void applyUniformDelta(const ShaderUniformDelta& delta);
+
+    /** @returns Last applied version of model, or 0 if never applied */
+    uint64_t getModelVersion(unsigned int modelID) const;
+
+    /** @returns Whether linked program declares uniform block with
+     *  blockName. False while the link is pending, without waiting. */
+    bool hasUniformBlock(const std::string& blockName) const {
+        return !isStatusPending && uniformManager.hasUniformBlock(blockName);
+    }
+
     class Builder : public IBuilder<GLShaderProgram> {
      public:
         /** @brief Add fragment shader object to program. */
@@ -83,6 +147,12 @@ class GLShaderProgram : public IDataSubscriber,
         Builder& withFragmentShaderFromFile(
             std::filesystem::path filePath);
 
+        /** @brief Build fragment shader variant from filepath with
+         *  defines, reusing it if already compiled. */
+        Builder& withFragmentShaderFromFile(
+            std::filesystem::path filePath,
+            const GLShaderDefines& defines);
+
         /** @brief Build fragment shader from raw code. */
         Builder& withFragmentShaderFromCode(
             const std::string& shaderCode);
@@ -95,6 +165,12 @@ class GLShaderProgram : public IDataSubscriber,
         Builder& withVertexShaderFromFile(
             std::filesystem::path filePath);
 
+        /** @brief Build vertex shader variant from filepath with
+         *  defines, reusing it if already compiled. */
+        Builder& withVertexShaderFromFile(
+            std::filesystem::path filePath,
+            const GLShaderDefines& defines);
+
         /** @brief Build vertex shader from raw code. */
         Builder& withVertexShaderFromCode(
             const std::string& shaderCode);
@@ -102,6 +178,9 @@ class GLShaderProgram : public IDataSubscriber,
         /** @brief Add no-op vertex shader. */
         Builder& withDefaultVertexShader();
 
+        /** @brief Freeze uniform, see GLShaderProgram::freezeUniform. */
+        Builder& withFrozenUniform(const std::string& name);
+
         /** @brief Set uniform value. */
         template<class T>
         Builder& withUniform(std::shared_ptr<GLUniform> uniform) {
@@ -117,20 +196,45 @@ class GLShaderProgram : public IDataSubscriber,
     Logger& logger = Logger::get();
 
     void compile();
+    void checkLinkStatus();
+    void loadVertexAttributes();
 
     void attachShader(GLint shaderID);
     void detachShader(GLint shaderID);
 
     void destroyShaderProgram();
 
+    void updateSpecialization();
+    void specialize();
+    void resetSpecialization();
+
+    static std::optional<std::string> getConstantValues(
+        const GLUniform& uniform);
+
+    std::shared_ptr<GLUniformBuffer> getUniformBuffer(
+        const std::string& blockName);
+
     GLuint ID = 0;
 
     GLProgramUniformManager uniformManager;
+    std::map<unsigned int, uint64_t> modelVersions;
+    std::map<std::string, std::shared_ptr<GLUniformBuffer>> uniformBuffers;
+    std::vector<std::shared_ptr<GLUniform>> uniformBatch;
 
     std::shared_ptr<GLVertexShader> vertexShader = nullptr;
     std::shared_ptr<GLFragmentShader> fragmentShader = nullptr;
 
+    std::set<std::string> frozenUniforms;
+    std::map<std::string, std::vector<std::byte>> frozenValues;
+    std::shared_ptr<GLShaderProgram> specializedProgram = nullptr;
+    std::shared_ptr<GLShaderProgram> pendingSpecialization = nullptr;
+
     bool hasLinked = false;
+    bool isStatusPending = false;
+    bool isLoadedFromBinary = false;
+    bool hasAttributes = true;
+    FrameClock::time_point linkStartTime;
+    GLShader::CompileMode compileMode = GLShader::CompileMode::BLOCKING;
 
     LOGGER_FORMAT LOG_LINK_SUCCESS =
         "Shader Program (ID{:02}) - Program linked successfully.";
@@ -143,12 +247,21 @@ class GLShaderProgram : public IDataSubscriber,
     LOGGER_FORMAT LOG_DETACH =
         "Shader Program (ID{:02}) - Detaching shader (ID{:02}).";
 
+    LOGGER_FORMAT LOG_SPECIALIZE =
+        "Shader Program (ID{:02}) - Specializing with {} frozen uniforms.";
+    LOGGER_FORMAT LOG_SPECIALIZE_FAILURE =
+        "Shader Program (ID{:02}) - Specialization failed, "
+        "using generic program.";
+
     LOGGER_FORMAT LOG_DELETE =
         "Shader Program (ID{:02}) - Program deleted.";
 
     LOGGER_FORMAT LOG_UNIFORM_FAILURE =
         "Shader Program (ID{:02}) - Could not get location for uniform "
         "with name \"{}\".";
+    LOGGER_FORMAT LOG_DELTA_GAP =
+        "Shader Program (ID{:02}) - Delta of model {} from version {} "
+        "skips past version {}, waiting for full model.";
 };
 
 }   // namespace basil
@@ -0,0 +1,157 @@
+#include "GLStateCache.hpp"
+
+#include "Process/GLCallMetrics.hpp"
+
+namespace basil {
+
+template<class T>
+bool GLStateCache::update(std::optional<T>& current, const T& value) {
+    checkContext();
+
+    if (current == value) {
+        skippedCount++;
+        return false;
+    }
+
+    current = value;
+    issuedCount++;
+    BASIL_COUNT_GL_CALL(GLCallType::BIND);
+    return true;
+}
+
+void GLStateCache::checkContext() {
+    // State of a previous context does not carry over
+    if (contextVersion != BasilContext::getContextVersion()) {
+        invalidate();
+        contextVersion = BasilContext::getContextVersion();
+    }
+}
+
+void GLStateCache::useProgram(GLuint programID) {
+    if (update(program, programID)) {
+        glUseProgram(programID);
+    }
+}
+
+void GLStateCache::bindVertexArray(GLuint vertexArrayID) {
+    if (update(vertexArray, vertexArrayID)) {
+        glBindVertexArray(vertexArrayID);
+    }
+}
+
+void GLStateCache::bindTexture(
+        GLenum textureUnit, GLenum target, GLuint textureID) {
+    checkContext();
+
+    auto binding = std::make_pair(textureUnit, target);
+    auto found = textures.find(binding);
+    if (found != textures.end() && found->second == textureID) {
+        skippedCount++;
+        return;
+    }
+
+    if (update(activeTexture, textureUnit)) {
+        glActiveTexture(textureUnit);
+    }
+
+    textures[binding] = textureID;
+    issuedCount++;
+    BASIL_COUNT_GL_CALL(GLCallType::BIND);
+    glBindTexture(target, textureID);
+}
+
+void GLStateCache::setActiveTexture(GLenum textureUnit) {
+    if (update(activeTexture, textureUnit)) {
+        glActiveTexture(textureUnit);
+    }
+}
+
+void GLStateCache::setViewport(
+        GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (update(viewport, Viewport { x, y, width, height })) {
+        glViewport(x, y, width, height);
+    }
+}
+
+void GLStateCache::setBlendEnabled(bool isEnabled) {
+    if (update(isBlendEnabled, isEnabled)) {
+        if (isEnabled) {
+            glEnable(GL_BLEND);
+        } else {
+            glDisable(GL_BLEND);
+        }
+    }
+}
+
+void GLStateCache::setBlendFunc(
+        GLenum sourceFactor, GLenum destinationFactor) {
+    if (update(blendFunc, BlendFunc { sourceFactor, destinationFactor })) {
+        glBlendFunc(sourceFactor, destinationFactor);
+    }
+}
+
+void GLStateCache::bindPixelBuffer(GLenum target, GLuint bufferID) {
+    auto& buffer = (target == GL_PIXEL_PACK_BUFFER)
+        ? packBuffer : unpackBuffer;
+
+    if (update(buffer, bufferID)) {
+        glBindBuffer(target, bufferID);
+    }
+}
+
+void GLStateCache::setUnpackAlignment(GLint alignment) {
+    if (update(unpackAlignment, alignment)) {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+    }
+}
+
+void GLStateCache::releaseProgram(GLuint programID) {
+    // Deleted program stays in use until replaced, so state is unknown
+    if (program == programID) {
+        program = std::nullopt;
+    }
+}
+
+void GLStateCache::releaseVertexArray(GLuint vertexArrayID) {
+    // Deleting a bound object reverts its binding to zero
+    if (vertexArray == vertexArrayID) {
+        vertexArray = 0;
+    }
+}
+
+void GLStateCache::releaseTexture(GLuint textureID) {
+    for (auto& [binding, boundID] : textures) {
+        if (boundID == textureID) {
+            boundID = 0;
+        }
+    }
+}
+
+void GLStateCache::releaseBuffer(GLuint bufferID) {
+    if (packBuffer == bufferID) {
+        packBuffer = 0;
+    }
+    if (unpackBuffer == bufferID) {
+        unpackBuffer = 0;
+    }
+}
+
+void GLStateCache::invalidate() {
+    program = std::nullopt;
+    vertexArray = std::nullopt;
+    activeTexture = std::nullopt;
+    textures.clear();
+    viewport = std::nullopt;
+    isBlendEnabled = std::nullopt;
+    blendFunc = std::nullopt;
+    packBuffer = std::nullopt;
+    unpackBuffer = std::nullopt;
+    unpackAlignment = std::nullopt;
+}
+
+void GLStateCache::resetCounts() {
+    issuedCount = 0;
+    skippedCount = 0;
+}
+
+}  // namespace basil
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <utility>
+
+#include <Basil/Packages/Context.hpp>
+
+namespace basil {
+
+/** @brief Shadow copy of OpenGL context state, using Singleton pattern.
+ *  Basil's GL wrappers bind through the cache, which skips calls that
+ *  would set state to its current value. Covers the current program,
+ *  vertex array, textures per unit, viewport, blending, pixel
+ *  pack/unpack buffers and unpack alignment. Must only be used from
+ *  the thread owning the context. Code changing this state with raw
+ *  OpenGL calls must call invalidate() afterwards. */
+class GLStateCache {
+ public:
+    /** @return Instance of Singleton cache. */
+    static GLStateCache& get() {
+        static GLStateCache instance;
+        return instance;
+    }
+
+    /** @brief Call glUseProgram, unless program is already in use. */
+    void useProgram(GLuint programID);
+
+    /** @brief Call glBindVertexArray, unless already bound. */
+    void bindVertexArray(GLuint vertexArrayID);
+
+    /** @brief Bind texture to unit, calling glActiveTexture and
+     *  glBindTexture only where the current state differs.
+     *  @param textureUnit  Unit enum, e.g. GL_TEXTURE0
+     *  @param target       Texture target, e.g. GL_TEXTURE_2D */
+    void bindTexture(GLenum textureUnit, GLenum target, GLuint textureID);
+
+    /** @brief Call glActiveTexture, unless unit is already active. */
+    void setActiveTexture(GLenum textureUnit);
+
+    /** @brief Call glViewport, unless viewport is unchanged. */
+    void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    /** @brief Enable or disable GL_BLEND, unless already set. */
+    void setBlendEnabled(bool isEnabled);
+
+    /** @brief Call glBlendFunc, unless factors are unchanged. */
+    void setBlendFunc(GLenum sourceFactor, GLenum destinationFactor);
+
+    /** @brief Bind GL_PIXEL_PACK_BUFFER or GL_PIXEL_UNPACK_BUFFER,
+     *  unless already bound. */
+    void bindPixelBuffer(GLenum target, GLuint bufferID);
+
+    /** @brief Set GL_UNPACK_ALIGNMENT, unless already set. */
+    void setUnpackAlignment(GLint alignment);
+
+    /** @brief Forget bindings of deleted program. */
+    void releaseProgram(GLuint programID);
+
+    /** @brief Forget bindings of deleted vertex array. */
+    void releaseVertexArray(GLuint vertexArrayID);
+
+    /** @brief Forget bindings of deleted texture. */
+    void releaseTexture(GLuint textureID);
+
+    /** @brief Forget bindings of deleted buffer. */
+    void releaseBuffer(GLuint bufferID);
+
+    /** @brief Forget all cached state, so that the next call of each
+     *  kind is issued. */
+    void invalidate();
+
+    /** @returns Number of calls passed on to OpenGL. */
+    uint64_t getIssuedCount() const { return issuedCount; }
+
+    /** @returns Number of calls skipped as redundant. */
+    uint64_t getSkippedCount() const { return skippedCount; }
+
+    /** @brief Reset issued and skipped counts to zero. */
+    void resetCounts();
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    using Viewport = std::array<GLint, 4>;
+    using BlendFunc = std::pair<GLenum, GLenum>;
+    using TextureBinding = std::pair<GLenum, GLenum>;
+
+    GLStateCache() = default;
+
+    void checkContext();
+
+    template<class T>
+    bool update(std::optional<T>& current, const T& value);
+
+    std::optional<GLuint> program;
+    std::optional<GLuint> vertexArray;
+    std::optional<GLenum> activeTexture;
+    std::map<TextureBinding, GLuint> textures;
+    std::optional<Viewport> viewport;
+    std::optional<bool> isBlendEnabled;
+    std::optional<BlendFunc> blendFunc;
+    std::optional<GLuint> packBuffer;
+    std::optional<GLuint> unpackBuffer;
+    std::optional<GLint> unpackAlignment;
+
+    unsigned int contextVersion = 0;
+    uint64_t issuedCount = 0;
+    uint64_t skippedCount = 0;
+};
+
+}   // namespace basil
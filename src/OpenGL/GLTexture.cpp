@@ -1,6 +1,14 @@
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "GLTexture.hpp"
+#include "GLStateCache.hpp"
+#include "GLTextureUnitAllocator.hpp"
+
+#include "Process/GLCallMetrics.hpp"
 
 namespace basil {
 
@@ -32,6 +40,10 @@ GLTextureCubemap::GLTextureCubemap() {
 }
 
 void IGLTexture::setTextureParameter(GLenum parameterName, GLenum value) {
+    // Recorded to reapply when storage is reallocated
+    parameters[parameterName] = value;
+
+    bindTexture();
     glTexParameteri(textureType, parameterName, value);
 }
 
@@ -42,13 +54,25 @@ void GLTextureCubemap::setSource(
         sources.at(face) = setSource;
     }
 
+    bindTexture();
     updateGLTexImage(face, setSource);
 }
 
+GLint IGLTexture::bindUnit() {
+    GLint unit = GLTextureUnitAllocator::get().bind(textureType, textureId);
+    textureEnum = GL_TEXTURE0 + unit;
+    return unit;
+}
+
+void IGLTexture::bindTexture() {
+    // Texture functions act on the active unit
+    bindUnit();
+    GLStateCache::get().setActiveTexture(textureEnum);
+}
+
 void IGLTexture::initializeTexture() {
     glGenTextures(1, &textureId);
-    glActiveTexture(textureEnum);
-    glBindTexture(textureType, textureId);
+    bindTexture();
 
     logger.log(
         fmt::format(LOG_TEXTURE_CREATED,
@@ -65,6 +89,96 @@ void IGLTexture::initializeTexture() {
     setTextureParameter(GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 }
 
+bool IGLTexture::allocateStorage(
+        std::array<int, 3> size, GLenum internalFormat) {
+    if (size[0] <= 0 || size[1] <= 0 || size[2] <= 0) return false;
+    if (size == storageSize && internalFormat == storageFormat) return true;
+
+    // Immutable storage can not be resized, so replace texture object
+    if (storageFormat != 0) {
+        GLuint oldTextureId = textureId;
+        glDeleteTextures(1, &oldTextureId);
+        GLStateCache::get().releaseTexture(oldTextureId);
+        GLTextureUnitAllocator::get().release(oldTextureId);
+
+        glGenTextures(1, &textureId);
+        bindTexture();
+        for (const auto& [parameterName, value] : parameters) {
+            glTexParameteri(textureType, parameterName, value);
+        }
+
+        logger.log(
+            fmt::format(LOG_TEXTURE_REALLOCATED,
+                textureId, oldTextureId, size[0], size[1], size[2]),
+            LogLevel::DEBUG);
+    }
+
+    switch (textureType) {
+        case GL_TEXTURE_1D:
+            glTexStorage1D(textureType, 1, internalFormat, size[0]);
+            break;
+        case GL_TEXTURE_3D:
+            glTexStorage3D(textureType, 1, internalFormat,
+                size[0], size[1], size[2]);
+            break;
+        default:
+            glTexStorage2D(textureType, 1, internalFormat,
+                size[0], size[1]);
+            break;
+    }
+
+    storageSize = size;
+    storageFormat = internalFormat;
+    return true;
+}
+
+void IGLTexture::stageUploads(std::vector<RegionUpload>& uploads) {
+    auto& stateCache = GLStateCache::get();
+
+    // Regions are packed into one ring region, so that an update waits
+    // on at most one fence, however many regions it has
+    std::size_t totalBytes = 0;
+    for (const RegionUpload& upload : uploads) {
+        totalBytes += GLPixelUploadRing::align(upload.bytes);
+    }
+
+    // Upload first update directly, as most textures are never updated.
+    // Very large uploads are also direct, rather than tripling their size
+    isUploadStaged = !uploads.empty() && uploadCount++ > 0
+        && totalBytes <= BASIL_TEXTURE_UPLOAD_BUFFER_MAX_BYTES;
+    if (!isUploadStaged) {
+        stateCache.bindPixelBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        for (RegionUpload& upload : uploads) {
+            upload.pixels = upload.data;
+        }
+        return;
+    }
+
+    if (!uploadRing || uploadRing->getRegionSize() < totalBytes) {
+        uploadRing = std::make_unique<GLPixelUploadRing>(totalBytes);
+    }
+
+    std::byte* region = uploadRing->acquire();
+    std::size_t offset = uploadRing->getOffset();
+    for (RegionUpload& upload : uploads) {
+        if (region) {
+            std::memcpy(region, upload.data, upload.bytes);
+            region += GLPixelUploadRing::align(upload.bytes);
+        }
+        upload.pixels = reinterpret_cast<const void*>(offset);
+        offset += GLPixelUploadRing::align(upload.bytes);
+    }
+    stateCache.bindPixelBuffer(GL_PIXEL_UNPACK_BUFFER, uploadRing->getID());
+}
+
+void IGLTexture::finishUploads() {
+    if (!isUploadStaged) return;
+
+    uploadRing->fence();
+    GLStateCache::get().bindPixelBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    isUploadStaged = false;
+}
+
 template<int N>
 void GLTexture<N>::update() {
     if (!source) {
@@ -74,13 +188,12 @@ void GLTexture<N>::update() {
         return;
     }
 
-    glActiveTexture(textureEnum);
+    bindTexture();
     updateGLTexImage();
-    glBindTexture(textureType, textureId);
 }
 
 void GLTextureCubemap::update() {
-    glActiveTexture(textureEnum);
+    bindTexture();
 
     for (auto face : sources) {
         if (!face.second) {
@@ -92,66 +205,157 @@ void GLTextureCubemap::update() {
 
         updateGLTexImage(face.first, face.second);
     }
+}
+
+std::optional<IGLTexture::RegionUpload> IGLTexture::clipRegion(
+        const TextureRegion& region,
+        const void* data,
+        std::size_t pixelSize) const {
+    RegionUpload upload;
+    for (int i = 0; i < 3; i++) {
+        upload.offset[i] = std::max(region.offset[i], 0);
+        upload.size[i] = std::min(region.offset[i] + region.size[i],
+            storageSize[i]) - upload.offset[i];
+        if (upload.size[i] <= 0) return std::nullopt;
+    }
 
-    glBindTexture(textureType, textureId);
+    // Start from first pixel of region, rather than using GL_UNPACK_SKIP_*,
+    // so that only the span from its first to last pixel is staged
+    auto [width, height, depth] = storageSize;
+    auto [x, y, z] = upload.offset;
+    auto [sizeX, sizeY, sizeZ] = upload.size;
+    std::size_t first = (std::size_t(z) * height + y) * width + x;
+    std::size_t pixels =
+        (std::size_t(sizeZ - 1) * height + sizeY - 1) * width + sizeX;
+    upload.data = static_cast<const std::byte*>(data) + first * pixelSize;
+    upload.bytes = pixels * pixelSize;
+    return upload;
+}
+
+void IGLTexture::uploadRegion(const GLTextureFormat& format,
+        const RegionUpload& upload) {
+    const std::array<int, 3>& offset = upload.offset;
+    const std::array<int, 3>& size = upload.size;
+    auto [width, height, depth] = storageSize;
+
+    // Rows are tightly packed, rather than padded to 4 bytes as GL
+    // expects by default, e.g. for RGB8 data of odd width
+    GLStateCache::get().setUnpackAlignment(1);
+
+    bool isPartial = size != storageSize;
+    if (isPartial) {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+        glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, height);
+    }
+
+    switch (textureType) {
+        case GL_TEXTURE_1D:
+            glTexSubImage1D(textureType, 0,
+                offset[0], size[0],
+                format.format, format.type, upload.pixels);
+            break;
+        case GL_TEXTURE_3D:
+            glTexSubImage3D(textureType, 0,
+                offset[0], offset[1], offset[2],
+                size[0], size[1], size[2],
+                format.format, format.type, upload.pixels);
+            break;
+        default:
+            glTexSubImage2D(textureType, 0,
+                offset[0], offset[1],
+                size[0], size[1],
+                format.format, format.type, upload.pixels);
+            break;
+    }
+
+    if (isPartial) {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+    }
+    BASIL_COUNT_GL_CALL(GLCallType::TEXTURE_UPLOAD,
+        std::size_t(size[0]) * size[1] * size[2] * format.getPixelSize());
+}
+
+template<int N>
+void GLTexture<N>::uploadSource(std::array<int, 3> size) {
+    const GLTextureFormat& format = source->format;
+    bool isReallocated = size != storageSize
+        || format.internalFormat != storageFormat;
+    const void* data = source->data();
+    if (!allocateStorage(size, format.internalFormat) || !data) {
+        return;
+    }
+
+    // Newly allocated storage is undefined, so is filled in full
+    std::vector<TextureRegion> regions = source->getDirtyRegions();
+    if (isReallocated || regions.empty()) {
+        regions = { TextureRegion { { 0, 0, 0 }, size } };
+    }
+
+    std::vector<RegionUpload> uploads;
+    for (const TextureRegion& region : regions) {
+        auto upload = clipRegion(region, data, format.getPixelSize());
+        if (upload) {
+            uploads.push_back(*upload);
+        }
+    }
+
+    stageUploads(uploads);
+    for (const RegionUpload& upload : uploads) {
+        uploadRegion(format, upload);
+    }
+    finishUploads();
+    source->clearDirtyRegions();
 }
 
 template<>
 void GLTexture<1>::updateGLTexImage() {
-    glTexImage1D(textureType,
-                 0,
-                 source->format.internalFormat,
-                 source->getWidth(),
-                 0,
-                 source->format.format,
-                 source->format.type,
-                 source->data());
+    uploadSource({ source->getWidth(), 1, 1 });
 }
 
 template<>
 void GLTexture<2>::updateGLTexImage() {
-    glTexImage2D(textureType,
-                 0,
-                 source->format.internalFormat,
-                 source->getWidth(),
-                 source->getHeight(),
-                 0,
-                 source->format.format,
-                 source->format.type,
-                 source->data());
+    uploadSource({ source->getWidth(), source->getHeight(), 1 });
 }
 
 template<>
 void GLTexture<3>::updateGLTexImage() {
-    glTexImage3D(textureType,
-                 0,
-                 source->format.internalFormat,
-                 source->getWidth(),
-                 source->getHeight(),
-                 source->getDepth(),
-                 0,
-                 source->format.format,
-                 source->format.type,
-                 source->data());
+    uploadSource({
+        source->getWidth(), source->getHeight(), source->getDepth() });
 }
 
 void GLTextureCubemap::updateGLTexImage(GLenum face,
         std::shared_ptr<ITextureSource<2>> source) {
-    glTexImage2D(face,
-                 0,
-                 source->format.internalFormat,
-                 source->getWidth(),
-                 source->getHeight(),
-                 0,
-                 source->format.format,
-                 source->format.type,
-                 source->data());
+    int width = source->getWidth();
+    int height = source->getHeight();
+    const void* data = source->data();
+    if (!allocateStorage({ width, height, 1 }, source->format.internalFormat)
+            || !data) {
+        return;
+    }
+
+    // Faces are uploaded directly, as cubemaps are rarely streamed
+    auto& stateCache = GLStateCache::get();
+    stateCache.bindPixelBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    stateCache.setUnpackAlignment(1);
+    glTexSubImage2D(face,
+                    0,
+                    0, 0,
+                    width,
+                    height,
+                    source->format.format,
+                    source->format.type,
+                    data);
+    BASIL_COUNT_GL_CALL(GLCallType::TEXTURE_UPLOAD,
+        source->format.getPixelSize() * width * height);
 }
 
 template<int N>
 GLTexture<N>::~GLTexture() {
     GLuint textureArray[] = { textureId };
     glDeleteTextures(1, textureArray);
+    GLStateCache::get().releaseTexture(textureId);
+    GLTextureUnitAllocator::get().release(textureId);
 
     logger.log(
         fmt::format(LOG_TEXTURE_DELETED, textureId),
@@ -161,6 +365,8 @@ GLTexture<N>::~GLTexture() {
 GLTextureCubemap::~GLTextureCubemap() {
     GLuint textureArray[] = { textureId };
     glDeleteTextures(1, textureArray);
+    GLStateCache::get().releaseTexture(textureId);
+    GLTextureUnitAllocator::get().release(textureId);
 
     logger.log(
         fmt::format(LOG_TEXTURE_DELETED, textureId),
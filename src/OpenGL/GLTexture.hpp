@@ -4,13 +4,17 @@
 
 #include <GL/glew.h>
 
+#include <array>
+#include <cstddef>
 #include <filesystem>
 #include <future>
 #include <map>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <stack>
 #include <utility>
+#include <vector>
 
 #include <Basil/Packages/Builder.hpp>
 #include <Basil/Packages/Context.hpp>
@@ -20,6 +24,7 @@
 
 #include "File/FileTextureSource.hpp"
 
+#include "OpenGL/GLPixelUploadRing.hpp"
 #include "OpenGL/ITextureSource.hpp"
 #include "OpenGL/SpanTextureSource.hpp"
 
@@ -27,12 +32,17 @@
 namespace basil {
 
 /**
- * @brief       Interface for texture template class.
+ * @brief       Interface for texture template class. Textures have
+ *              immutable storage, which is reallocated only when the
+ *              size or format of the source changes. Textures updated
+ *              more than once stream through a GLPixelUploadRing.
+ *              Only regions marked dirty on the source are uploaded,
+ *              packed together into one ring region per update.
  */
 class IGLTexture {
  public:
     /** @brief Assign texture memory in OpenGL. */
-    IGLTexture() : textureEnum(nextTexture++) {}
+    IGLTexture() = default;
 
     /** @brief Destructor to tear down OpenGL assigned memory. */
     ~IGLTexture() = default;
@@ -40,12 +50,17 @@ class IGLTexture {
     /** @return OpenGL-assigned ID of texture. */
     GLuint getID() const { return textureId; }
 
-    /** @return OpenGL-assigend Enum for texture. */
+    /** @return Enum of unit texture was last bound to. */
     GLenum getEnum() const { return textureEnum; }
 
-    /** @return Value to pass into shader program setUniform. */
+    /** @return Index of unit texture was last bound to. Units are
+     *  reassigned at draw time, see GLTextureUnitAllocator. */
     GLint getUniformLocation() { return textureEnum - GL_TEXTURE0; }
 
+    /** @brief Bind texture to a unit, keeping its current unit if it
+     *  has one. @returns Index of unit, to pass to sampler uniform. */
+    GLint bindUnit();
+
     /** @brief Flushes data from source to texture. */
     virtual void update() = 0;
 
@@ -58,21 +73,48 @@ class IGLTexture {
 #endif
     Logger& logger = Logger::get();
 
+    void bindTexture();
     void initializeTexture();
-    virtual void updateGLTexImage() = 0;
+    bool allocateStorage(std::array<int, 3> size, GLenum internalFormat);
+
+    /** @brief Dirty region clipped to storage, with the span of source
+     *  data from its first to last pixel. */
+    struct RegionUpload {
+        std::array<int, 3> offset;
+        std::array<int, 3> size;
+        const std::byte* data;
+        std::size_t bytes;
+        const void* pixels = nullptr;
+    };
 
-    inline static GLenum nextTexture = GL_TEXTURE0;
+    std::optional<RegionUpload> clipRegion(const TextureRegion& region,
+        const void* data, std::size_t pixelSize) const;
+    void stageUploads(std::vector<RegionUpload>& uploads);
+    void finishUploads();
+    void uploadRegion(const GLTextureFormat& format,
+        const RegionUpload& upload);
+    virtual void updateGLTexImage() = 0;
 
     GLenum textureType;
-    GLenum textureEnum;
+    GLenum textureEnum = GL_TEXTURE0;
     GLuint textureId;
 
+    std::map<GLenum, GLenum> parameters;
+    std::array<int, 3> storageSize = { 0, 0, 0 };
+    GLenum storageFormat = 0;
+
+    unsigned int uploadCount = 0;
+    bool isUploadStaged = false;
+    std::unique_ptr<GLPixelUploadRing> uploadRing;
+
     LOGGER_FORMAT LOG_SOURCE_MISSING =
         "Texture (ID{:02}) - Unable to update, data source not found.";
     LOGGER_FORMAT LOG_TEXTURE_CREATED =
         "Texture (ID{:02}) - Created {} texture with offset {}.";
     LOGGER_FORMAT LOG_TEXTURE_DELETED =
         "Texture (ID{:02}) - Texture deleted.";
+    LOGGER_FORMAT LOG_TEXTURE_REALLOCATED =
+        "Texture (ID{:02}) - Replaced texture (ID{:02}) to resize to {}x{}x{}.";
 
     static inline const std::unordered_map<GLenum, std::string_view>
         NAME_LOOKUP = {
@@ -135,6 +177,7 @@ class GLTexture : public IGLTexture,
  private:
 #endif
     void updateGLTexImage() override;
+    void uploadSource(std::array<int, 3> size);
 
     std::shared_ptr<ITextureSource<N>> source;
 };
@@ -2,6 +2,9 @@
 
 #include <GL/glew.h>
 
+#include <cstddef>
+#include <optional>
+
 #ifdef _WIN32
 using u_int = unsigned int;
 using u_char = unsigned char;
@@ -22,6 +25,9 @@ struct GLTextureFormat {
     /** @brief Format to save texture as, i.e. GL_RED, GL_RGBA */
     GLenum  internalFormat;
 
+    /** @return Size of one pixel of source data, in bytes. */
+    constexpr std::size_t getPixelSize() const;
+
     /** @return Builds TextureFormat struct for a given type and number of channels
      *  @tparam T Numeric type of data
      *  @tparam channels Number of channels in image data
@@ -35,6 +41,13 @@ struct GLTextureFormat {
         };
     }
 
+    /** @return TextureFormat for a type enum and number of channels,
+     *  or std::nullopt if not supported
+     *  @param type     Numeric type of data, i.e. GL_FLOAT
+     *  @param channels Number of channels in image data */
+    static constexpr std::optional<GLTextureFormat> getTextureFormat(
+        GLenum type, int channels);
+
     template<typename T>
     static constexpr GLenum getType();
 
@@ -43,6 +56,10 @@ struct GLTextureFormat {
 
     template<typename T, int channels>
     static constexpr GLenum getInternalFormat();
+
+    template<typename T>
+    static constexpr std::optional<GLTextureFormat> getTextureFormat(
+        int channels);
 };
 
 template<> constexpr GLenum
@@ -144,5 +161,46 @@ template<> constexpr GLenum
 template<> constexpr GLenum
     GLTextureFormat::getInternalFormat<u_char, 4>()   { return GL_RGBA8;    }
 
+template<typename T>
+constexpr std::optional<GLTextureFormat>
+GLTextureFormat::getTextureFormat(int channels) {
+    switch (channels) {
+        case 1:     return getTextureFormat<T, 1>();
+        case 2:     return getTextureFormat<T, 2>();
+        case 3:     return getTextureFormat<T, 3>();
+        case 4:     return getTextureFormat<T, 4>();
+        default:    return std::nullopt;
+    }
+}
+
+constexpr std::optional<GLTextureFormat>
+GLTextureFormat::getTextureFormat(GLenum type, int channels) {
+    switch (type) {
+        case GL_FLOAT:          return getTextureFormat<float>(channels);
+        case GL_INT:            return getTextureFormat<int>(channels);
+        case GL_UNSIGNED_INT:   return getTextureFormat<u_int>(channels);
+        case GL_BYTE:           return getTextureFormat<char>(channels);
+        case GL_UNSIGNED_BYTE:  return getTextureFormat<u_char>(channels);
+        default:                return std::nullopt;
+    }
+}
+
+constexpr std::size_t GLTextureFormat::getPixelSize() const {
+    std::size_t channels = 4;
+    switch (format) {
+        case GL_RED: case GL_RED_INTEGER:   channels = 1; break;
+        case GL_RG:  case GL_RG_INTEGER:    channels = 2; break;
+        case GL_RGB: case GL_RGB_INTEGER:   channels = 3; break;
+    }
+
+    std::size_t channelSize = 4;
+    switch (type) {
+        case GL_BYTE: case GL_UNSIGNED_BYTE:        channelSize = 1; break;
+        case GL_SHORT: case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:                         channelSize = 2; break;
+    }
+
+    return channels * channelSize;
+}
 
 }   // namespace basil
@@ -0,0 +1,85 @@
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#include "GLTextureUnitAllocator.hpp"
+#include "GLStateCache.hpp"
+
+namespace basil {
+
+void GLTextureUnitAllocator::checkContext() {
+    // Units are reassigned in a new context, as their bindings are lost
+    if (contextVersion != BasilContext::getContextVersion()
+            || units.empty()) {
+        GLint maxUnits = 0;
+        glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxUnits);
+        unsigned int unitCount = std::min(
+            static_cast<unsigned int>(std::max(maxUnits, 1)), unitLimit);
+
+        units.assign(unitCount, TextureUnit());
+        residentUnits.clear();
+        contextVersion = BasilContext::getContextVersion();
+    }
+}
+
+GLint GLTextureUnitAllocator::bind(GLenum target, GLuint textureID) {
+    checkContext();
+
+    unsigned int unit;
+    auto found = residentUnits.find(textureID);
+    if (found != residentUnits.end()) {
+        unit = found->second;
+    } else {
+        unit = findUnusedUnit();
+        if (units.at(unit).lastUsed > drawStart) {
+            logger.log(
+                fmt::format(LOG_UNITS_EXHAUSTED, textureID, units.size()),
+                LogLevel::WARN);
+        }
+
+        residentUnits.erase(units.at(unit).textureID);
+        residentUnits[textureID] = unit;
+        units.at(unit).textureID = textureID;
+    }
+
+    units.at(unit).lastUsed = ++useCount;
+    GLStateCache::get().bindTexture(GL_TEXTURE0 + unit, target, textureID);
+    return unit;
+}
+
+unsigned int GLTextureUnitAllocator::findUnusedUnit() {
+    // Free units have never been used, so are found first
+    auto leastRecent = std::min_element(units.begin(), units.end(),
+        [](const TextureUnit& first, const TextureUnit& second) {
+            return first.lastUsed < second.lastUsed;
+        });
+    return leastRecent - units.begin();
+}
+
+void GLTextureUnitAllocator::beginDraw() {
+    drawStart = useCount;
+}
+
+void GLTextureUnitAllocator::endDraw() {
+    drawStart = UINT64_MAX;
+}
+
+void GLTextureUnitAllocator::release(GLuint textureID) {
+    auto found = residentUnits.find(textureID);
+    if (found == residentUnits.end()) return;
+
+    units.at(found->second) = TextureUnit();
+    residentUnits.erase(found);
+}
+
+void GLTextureUnitAllocator::setUnitLimit(unsigned int limit) {
+    unitLimit = std::max(limit, 1u);
+    units.clear();
+}
+
+unsigned int GLTextureUnitAllocator::getUnitCount() {
+    checkContext();
+    return units.size();
+}
+
+}  // namespace basil
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <Basil/Packages/Context.hpp>
+#include <Basil/Packages/Logging.hpp>
+
+namespace basil {
+
+/** @brief Assigns textures to texture units, using Singleton pattern.
+ *  Textures stay bound to their unit until it is needed for another
+ *  texture, at which point the least recently used unit is reused.
+ *  Units are reused only if no draw is being bound, or if they were
+ *  bound before the current draw began, so that all textures of one
+ *  draw remain bound. Assignments are reset when the context is
+ *  re-created. */
+class GLTextureUnitAllocator {
+ public:
+    /** @return Instance of Singleton allocator. */
+    static GLTextureUnitAllocator& get() {
+        static GLTextureUnitAllocator instance;
+        return instance;
+    }
+
+    /** @brief Bind texture to a unit, keeping its current unit if it
+     *  has one.
+     *  @param target   Texture target, e.g. GL_TEXTURE_2D
+     *  @returns        Index of unit, to pass to sampler uniform */
+    GLint bind(GLenum target, GLuint textureID);
+
+    /** @brief Start binding textures for a draw. Units bound until
+     *  endDraw() are not reused for other textures of the draw. */
+    void beginDraw();
+
+    /** @brief Finish binding textures for a draw. */
+    void endDraw();
+
+    /** @brief Free unit of deleted texture. */
+    void release(GLuint textureID);
+
+    /** @brief Limit number of units used, e.g. to leave units free for
+     *  other code. Clears current assignments. */
+    void setUnitLimit(unsigned int limit);
+
+    /** @returns Number of units available for assignment. */
+    unsigned int getUnitCount();
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    struct TextureUnit {
+        GLuint textureID = 0;
+        uint64_t lastUsed = 0;
+    };
+
+    GLTextureUnitAllocator() = default;
+
+    void checkContext();
+    unsigned int findUnusedUnit();
+
+    std::vector<TextureUnit> units;
+    std::unordered_map<GLuint, unsigned int> residentUnits;
+    unsigned int unitLimit = UINT32_MAX;
+
+    uint64_t useCount = 0;
+    uint64_t drawStart = UINT64_MAX;
+    unsigned int contextVersion = 0;
+
+    Logger& logger = Logger::get();
+
+    LOGGER_FORMAT LOG_UNITS_EXHAUSTED =
+        "Texture (ID{:02}) - All {} texture units are in use by the "
+        "current draw, replacing least recently used.";
+};
+
+}   // namespace basil
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <memory>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -10,21 +16,45 @@
 namespace basil {
 
 /** @brief Variant of data types which can be cast to OpenGL uniforms */
-using GLUniformVariant = std::variant<int, unsigned int, float, bool>;
+using GLUniformVariant =
+    std::variant<int, unsigned int, float, bool, double>;
 
 /** @brief Concept restricting uniform data types */
 template<class T>
 concept GLUniformType = std::is_convertible_v<T, GLUniformVariant>;
 
+/** @brief Type in which values of uniform data type T are stored and
+ *  uploaded, i.e. T, except for booleans which are stored as int */
+template<GLUniformType T>
+using GLUniformSourceElement =
+    std::conditional_t<std::is_same_v<T, bool>, int, T>;
+
+/** @brief Name of uniform data type, as used in log messages.
+ *  Left undefined so that new source types fail to compile until named. */
+template<GLUniformType T>
+struct GLUniformTypeName;
+
+template<> struct GLUniformTypeName<int> {
+    static constexpr const char* value = "int"; };
+template<> struct GLUniformTypeName<unsigned int> {
+    static constexpr const char* value = "unsigned int"; };
+template<> struct GLUniformTypeName<float> {
+    static constexpr const char* value = "float"; };
+template<> struct GLUniformTypeName<double> {
+    static constexpr const char* value = "double"; };
+
 /** @brief Template class holding pointer to OpenGL uniform data */
 template<GLUniformType T>
 class GLUniformSource {
  public:
+    /** @brief Name of underlying data type */
+    static constexpr const char* typeName = GLUniformTypeName<T>::value;
+
     /** @brief Initialize GLUniformSource with given data pointer */
     explicit GLUniformSource(T* dataSource) : dataSource(dataSource) {}
 
     /** @returns Pointer to underlying data */
-    T* data() { return dataSource; }
+    T* data() const { return dataSource; }
 
  private:
     T* dataSource = nullptr;
@@ -34,7 +64,8 @@ class GLUniformSource {
 using GLUniformSourceGeneric = std::variant<
     GLUniformSource<int>,
     GLUniformSource<unsigned int>,
-    GLUniformSource<float>>;
+    GLUniformSource<float>,
+    GLUniformSource<double>>;
 
 /** @brief Concept restricting to underlying OpenGL uniform data types */
 template<class T>
@@ -45,7 +76,7 @@ concept GLUniformSourceType =
 class GLUniform {
  public:
     /** @returns Name of uniform in shader code */
-    std::string getName() const { return name;   }
+    const std::string& getName() const { return name; }
 
     /** @returns Length of vector data, or first dimension of matrix data */
     virtual unsigned int getLength() const { return length; }
@@ -57,7 +88,18 @@ class GLUniform {
     virtual unsigned int getCount()  const { return count;  }
 
     /** @returns Un-typed variant of source wrapper */
-    GLUniformSourceGeneric getSource() { return source; }
+    GLUniformSourceGeneric getSource() const { return source; }
+
+    /** @returns Whether data may change without the uniform being
+     *  reassigned, e.g. when it points to externally owned memory */
+    virtual bool isVolatile() const { return false; }
+
+    /** @returns Name of underlying data type */
+    const char* getSourceTypeName() const {
+        return std::visit([](const auto& s) {
+                return s.typeName;
+            }, this->source);
+    }
 
     /** @returns Void pointer to underlying data source */
     void* getData() {
@@ -66,6 +108,14 @@ class GLUniform {
             }, this->source);
     }
 
+    /** @returns Size of underlying data in bytes */
+    std::size_t getDataSize() const {
+        std::size_t elementSize = std::visit([](const auto& s) {
+                return sizeof(*s.data());
+            }, this->source);
+        return elementSize * getLength() * getWidth() * getCount();
+    }
+
  protected:
     GLUniform(
         GLUniformSourceGeneric uniformSource,
@@ -112,6 +162,9 @@ class GLUniformPointer : public GLUniform {
         : GLUniformPointer(pointer,
             base.getName(), base.getLength(),
             base.getWidth(), base.getCount()) {}
+
+    /** @returns True, as pointed-to data is owned externally */
+    bool isVolatile() const override { return true; }
 };
 
 /** @brief Template specialization for boolean GLUniformPointer */
@@ -141,6 +194,9 @@ class GLUniformPointer<bool> : public GLUniform {
         : GLUniformPointer(pointer,
             base.getName(), base.getLength(),
             base.getWidth(), base.getCount()) {}
+
+    /** @returns True, as pointed-to data is owned externally */
+    bool isVolatile() const override { return true; }
 };
 
 /** @brief Implementation of GLUniform containing a scalar value */
@@ -162,6 +218,9 @@ class GLUniformScalar : public GLUniform {
     GLUniformScalar(T uniformValue, const GLUniform& base)
         : GLUniformScalar(uniformValue, base.getName()) {}
 
+    /** @brief Overwrites value in place */
+    void setValue(T uniformValue) { value = uniformValue; }
+
  private:
     T value;
 };
@@ -185,6 +244,11 @@ class GLUniformScalar<bool> : public GLUniform {
     GLUniformScalar(bool uniformValue, const GLUniform& base)
         : GLUniformScalar(uniformValue, base.getName()) {}
 
+    /** @brief Overwrites value in place */
+    void setValue(bool uniformValue) {
+        value = static_cast<int>(uniformValue);
+    }
+
  private:
     int value;
 };
@@ -208,7 +272,7 @@ class GLUniformVector : public GLUniform {
             unsigned int width = 1,
             unsigned int count = 0)
         : GLUniform(GLUniformSource<T>(nullptr), name, length, width, count),
-          sourceVector(vector) {
+          sourceVector(std::move(vector)) {
         if (this->length == 0) {
             this->length = sourceVector.size();
         }
@@ -222,7 +286,7 @@ class GLUniformVector : public GLUniform {
     GLUniformVector(
             std::vector<T> vector,
             const GLUniform& base)
-        : GLUniformVector(vector,
+        : GLUniformVector(std::move(vector),
             base.getName(), base.getLength(), base.getWidth()) {}
 
     /** @returns Count if provided, otherwise vector size / (length x width) */
@@ -231,6 +295,13 @@ class GLUniformVector : public GLUniform {
         return sourceVector.size() / (length * width);
     }
 
+    /** @brief Overwrites values in place. Only allocates if the
+     *  number of values differs from the current number. */
+    void setValue(std::span<const T> values) {
+        sourceVector.assign(values.begin(), values.end());
+        this->source = GLUniformSource<T>(this->sourceVector.data());
+    }
+
  private:
     std::vector<T> sourceVector;
 };
@@ -277,11 +348,145 @@ class GLUniformVector<bool> : public GLUniform {
         return sourceVector.size() / (length * width);
     }
 
+    /** @brief Overwrites values in place. Only allocates if the
+     *  number of values differs from the current number. */
+    void setValue(const std::vector<bool>& values) {
+        sourceVector.assign(values.begin(), values.end());
+        this->source = GLUniformSource<int>(this->sourceVector.data());
+    }
+
  private:
     std::vector<int> sourceVector;
 };
 
-/** @brief Implementation of GLUniform containing OpenGL texture location */
+/** @brief Implementation of GLUniform containing a fixed-size vector or
+ *  matrix, stored inline so that updates do not allocate
+ *  @tparam T       Data type of OpenGL uniform
+ *  @tparam Length  Length of vector, or first matrix dimension
+ *  @tparam Width   Second matrix dimension */
+template<GLUniformType T, unsigned int Length, unsigned int Width = 1>
+class GLUniformInline : public GLUniform {
+    using SourceType = GLUniformSourceElement<T>;
+
+ public:
+    /** @brief Number of values contained in uniform */
+    static constexpr std::size_t Size = Length * Width;
+
+    /** @brief Constructs GLUniform wrapper from array
+     *  @param values   Array of uniform values, column-major for matrices
+     *  @param name     Uniform name in shader code */
+    GLUniformInline(
+            const std::array<T, Size>& values,
+            const std::string& name)
+        : GLUniform(GLUniformSource<SourceType>(nullptr),
+            name, Length, Width, 1) {
+        setValue(values);
+        this->source = GLUniformSource<SourceType>(this->values.data());
+    }
+
+    /** @brief Reassigns value in GLUniformInline
+     *  @param values   Array of uniform values
+     *  @param base     Original GLUniform object */
+    GLUniformInline(
+            const std::array<T, Size>& values,
+            const GLUniform& base)
+        : GLUniformInline(values, base.getName()) {}
+
+    /** @brief Overwrites values in place */
+    void setValue(const std::array<T, Size>& values) {
+        std::copy(values.begin(), values.end(), this->values.begin());
+    }
+
+    /** @brief Overwrites leading values in place, ignoring any
+     *  values beyond the size of the uniform */
+    void setValue(std::span<const T> values) {
+        std::copy_n(values.begin(),
+            std::min(values.size(), Size), this->values.begin());
+    }
+
+ private:
+    std::array<SourceType, Size> values = {};
+};
+
+/** @brief Compile-time shape of a fixed-size vector or matrix type.
+ *  Specializations define the scalar `Element` type, the vector `Length`
+ *  or number of matrix rows, the `Width` or number of matrix columns,
+ *  and the array `Count`. Values are expected to be tightly packed and
+ *  column-major, as in GLSL. See GLUniformGLM.hpp for glm types. */
+template<class V>
+struct GLUniformShape {};
+
+/** @brief Shape of fixed-size array of vectors or matrices */
+template<class V, std::size_t N>
+    requires requires { GLUniformShape<V>::Count; }
+struct GLUniformShape<std::array<V, N>> {
+    using Element = typename GLUniformShape<V>::Element;
+    static constexpr unsigned int Length = GLUniformShape<V>::Length;
+    static constexpr unsigned int Width = GLUniformShape<V>::Width;
+    static constexpr unsigned int Count = GLUniformShape<V>::Count * N;
+};
+
+/** @brief Concept restricting to types with a tightly packed
+ *  GLUniformShape, which can be copied into a uniform as-is */
+template<class V>
+concept GLUniformShapedType = requires {
+        typename GLUniformShape<V>::Element;
+    }
+    && GLUniformType<typename GLUniformShape<V>::Element>
+    && std::is_trivially_copyable_v<V>
+    && sizeof(V) == sizeof(typename GLUniformShape<V>::Element)
+        * GLUniformShape<V>::Length
+        * GLUniformShape<V>::Width
+        * GLUniformShape<V>::Count;
+
+/** @brief Implementation of GLUniform containing a vector, matrix or
+ *  fixed-size array of either, whose shape is known at compile time.
+ *  Values are stored inline so that updates do not allocate.
+ *  @tparam V   Value type with a GLUniformShape, e.g. glm::dmat4 */
+template<GLUniformShapedType V>
+class GLUniformValue : public GLUniform {
+    using Shape = GLUniformShape<V>;
+    using T = typename Shape::Element;
+    using SourceType = GLUniformSourceElement<T>;
+
+ public:
+    /** @brief Number of values contained in uniform */
+    static constexpr std::size_t Size =
+        Shape::Length * Shape::Width * Shape::Count;
+
+    /** @brief Constructs GLUniform wrapper from value
+     *  @param value    Value of OpenGL uniform
+     *  @param name     Uniform name in shader code */
+    GLUniformValue(const V& value, const std::string& name)
+        : GLUniform(GLUniformSource<SourceType>(nullptr),
+            name, Shape::Length, Shape::Width, Shape::Count) {
+        setValue(value);
+        this->source = GLUniformSource<SourceType>(this->values.data());
+    }
+
+    /** @brief Reassigns value in GLUniformValue
+     *  @param value    Value of OpenGL uniform
+     *  @param base     Original GLUniform object */
+    GLUniformValue(const V& value, const GLUniform& base)
+        : GLUniformValue(value, base.getName()) {}
+
+    /** @brief Overwrites value in place */
+    void setValue(const V& value) {
+        if constexpr (std::is_same_v<T, SourceType>) {
+            std::memcpy(this->values.data(), &value, sizeof(V));
+        } else {
+            std::array<T, Size> elements;
+            std::memcpy(elements.data(), &value, sizeof(V));
+            std::copy(elements.begin(), elements.end(), this->values.begin());
+        }
+    }
+
+ private:
+    std::array<SourceType, Size> values = {};
+};
+
+/** @brief Implementation of GLUniform containing OpenGL texture unit,
+ *  which is resolved each time the program is used */
 class GLUniformTexture : public GLUniformScalar<int> {
  public:
     /** @brief Constructs GLUniform wrapper from texture
@@ -305,6 +510,10 @@ class GLUniformTexture : public GLUniformScalar<int> {
     /** @returns Pointer to IGLTexture object */
     std::shared_ptr<IGLTexture> getSource() const { return sourceTexture; }
 
+    /** @brief Bind texture to a unit for drawing, and set value of
+     *  uniform to that unit */
+    void bindTextureUnit() { setValue(sourceTexture->bindUnit()); }
+
  private:
     std::shared_ptr<IGLTexture> sourceTexture;
 };
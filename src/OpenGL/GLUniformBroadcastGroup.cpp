@@ -0,0 +1,145 @@
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <optional>
+
+#include "GLUniformBroadcastGroup.hpp"
+
+#include "Data/ShaderUniformModel.hpp"
+
+namespace basil {
+
+void GLUniformBroadcastGroup::addProgram(
+        std::shared_ptr<GLShaderProgram> program) {
+    if (!program) return;
+    if (std::find(programs.begin(), programs.end(), program)
+            != programs.end()) return;
+
+    sendModelStates(*program);
+    programs.push_back(program);
+}
+
+void GLUniformBroadcastGroup::removeProgram(
+        std::shared_ptr<GLShaderProgram> program) {
+    std::erase(programs, program);
+}
+
+void GLUniformBroadcastGroup::receiveData(const DataMessage& message) {
+    if (auto delta = message.getDataPointer<ShaderUniformDelta>()) {
+        applyUniformDelta(*delta);
+        return;
+    }
+
+    auto model = message.getDataPointer<ShaderUniformModel>();
+    if (!model) return;
+
+    unsigned int modelID = model->getModelID();
+    uint64_t lastSeen = 0;
+    if (modelStates.contains(modelID)) {
+        lastSeen = modelStates.at(modelID).version;
+    }
+
+    // Programs given the model outside of group need their own delta
+    for (const auto& program : programs) {
+        if (program->getModelVersion(modelID) != lastSeen) {
+            program->receiveData(message);
+        }
+    }
+
+    applyUniformDelta(model->getDelta(lastSeen));
+}
+
+void GLUniformBroadcastGroup::applyUniformDelta(
+        const ShaderUniformDelta& delta) {
+    bool blockWritten = false;
+    std::optional<ShaderUniformDelta> volatileDelta;
+
+    for (const auto& program : programs) {
+        // Values behind pointers change without a new model version
+        if (program->getModelVersion(delta.modelID) == delta.version) {
+            if (!volatileDelta) {
+                volatileDelta = delta;
+                std::erase_if(volatileDelta->uniforms, [](const auto& u) {
+                    return !u->isVolatile();
+                });
+            }
+            if (!volatileDelta->uniforms.empty()) {
+                program->applyUniformDelta(volatileDelta.value());
+            }
+            continue;
+        }
+
+        if (blockWritten && program->hasUniformBlock(delta.blockName)) {
+            program->applyUniformDelta(remainder);
+            continue;
+        }
+
+        program->applyUniformDelta(delta);
+        if (!blockWritten && program->hasUniformBlock(delta.blockName)) {
+            removeBlockMembers(delta);
+            blockWritten = true;
+        }
+    }
+
+    updateModelState(delta);
+}
+
+void GLUniformBroadcastGroup::updateModelState(
+        const ShaderUniformDelta& delta) {
+    ModelState& state = modelStates[delta.modelID];
+    if (delta.isComplete()) {
+        state.uniforms.clear();
+    }
+
+    state.blockName = delta.blockName;
+    for (const auto& uniform : delta.uniforms) {
+        state.uniforms[uniform->getName()] = uniform;
+    }
+
+    // After a missed delta, keep the old version, so that the next full
+    // model is diffed from it and fills in the missed uniforms
+    if (!delta.isComplete() && delta.baseVersion > state.version) {
+        logger.log(
+            fmt::format(LOG_DELTA_GAP, delta.modelID,
+                delta.baseVersion, state.version),
+            LogLevel::WARN);
+        return;
+    }
+    state.version = delta.version;
+}
+
+void GLUniformBroadcastGroup::sendModelStates(GLShaderProgram& program) {
+    for (const auto& [modelID, state] : modelStates) {
+        if (program.getModelVersion(modelID) == state.version) continue;
+
+        ShaderUniformDelta delta = {
+            .modelID = modelID,
+            .baseVersion = 0,
+            .version = state.version,
+            .blockName = state.blockName
+        };
+        for (const auto& [name, uniform] : state.uniforms) {
+            delta.uniforms.push_back(uniform);
+        }
+        program.applyUniformDelta(delta);
+    }
+}
+
+void GLUniformBroadcastGroup::removeBlockMembers(
+        const ShaderUniformDelta& delta) {
+    auto uniformBuffer = GLUniformBuffer::forBlock(delta.blockName);
+
+    remainder.modelID = delta.modelID;
+    remainder.baseVersion = delta.baseVersion;
+    remainder.version = delta.version;
+    remainder.blockName = delta.blockName;
+
+    remainder.uniforms.clear();
+    for (const auto& uniform : delta.uniforms) {
+        if (!uniformBuffer->hasMember(uniform->getName())) {
+            remainder.uniforms.push_back(uniform);
+        }
+    }
+}
+
+}  // namespace basil
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Basil/Packages/Builder.hpp>
+#include <Basil/Packages/Logging.hpp>
+#include <Basil/Packages/PubSub.hpp>
+
+#include "Data/ShaderUniformDelta.hpp"
+
+#include "GLShaderProgram.hpp"
+
+namespace basil {
+
+/** @brief Subscriber which forwards uniforms to a group of shader
+ *  programs sharing the same models, e.g. several panes sharing camera
+ *  uniforms. The changes of each model are collected once for the whole
+ *  group, and members of a shared uniform block are packed once rather
+ *  than once per program. */
+class GLUniformBroadcastGroup : public IDataSubscriber,
+                                public IBuildable<GLUniformBroadcastGroup> {
+ public:
+    /** @brief Add program to group. The program is sent the current
+     *  state of every model the group has received so far. */
+    void addProgram(std::shared_ptr<GLShaderProgram> program);
+
+    /** @brief Remove program from group */
+    void removeProgram(std::shared_ptr<GLShaderProgram> program);
+
+    /** @returns Programs in group */
+    const std::vector<std::shared_ptr<GLShaderProgram>>& getPrograms() const {
+        return programs;
+    }
+
+    /** @brief Forwards ShaderUniformModel or ShaderUniformDelta to all
+     *  programs in group. Overridden method from IDataSubscriber. */
+    void receiveData(const DataMessage& message) override;
+
+    /** @brief Applies delta to all programs in group */
+    void applyUniformDelta(const ShaderUniformDelta& delta);
+
+    /** @brief Builder pattern for GLUniformBroadcastGroup */
+    class Builder : public IBuilder<GLUniformBroadcastGroup> {
+     public:
+        /** @brief Add program to group */
+        Builder& withProgram(std::shared_ptr<GLShaderProgram> program) {
+            this->impl->addProgram(program);
+            return (*this);
+        }
+    };
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    /** @brief Latest uniforms of a model, used to seed new programs */
+    struct ModelState {
+        uint64_t version = 0;
+        std::string blockName;
+        std::map<std::string, std::shared_ptr<GLUniform>> uniforms;
+    };
+
+    void updateModelState(const ShaderUniformDelta& delta);
+    void sendModelStates(GLShaderProgram& program);
+    void removeBlockMembers(const ShaderUniformDelta& delta);
+
+    Logger& logger = Logger::get();
+
+    std::vector<std::shared_ptr<GLShaderProgram>> programs;
+    std::map<unsigned int, ModelState> modelStates;
+
+    ShaderUniformDelta remainder;
+
+    LOGGER_FORMAT LOG_DELTA_GAP =
+        "Uniform broadcast group - Delta of model {} from version {} "
+        "skips past version {}, waiting for full model.";
+};
+
+}   // namespace basil
@@ -0,0 +1,322 @@
+#include "GLUniformBuffer.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "Process/GLCallMetrics.hpp"
+
+namespace basil {
+
+std::shared_ptr<GLUniformBuffer> GLUniformBuffer::forBlock(
+        const std::string& blockName) {
+    if (registry.contains(blockName)) {
+        if (auto buffer = registry.at(blockName).lock()) {
+            return buffer;
+        }
+    }
+
+    auto buffer = std::make_shared<GLUniformBuffer>(blockName);
+    registry[blockName] = buffer;
+
+    return buffer;
+}
+
+GLUniformBuffer::GLUniformBuffer(const std::string& blockName)
+    : blockName(blockName),
+      bindingPoint(acquireBindingPoint()),
+      fences(BASIL_UNIFORM_BUFFER_COUNT, nullptr) {}
+
+GLUniformBuffer::~GLUniformBuffer() {
+    destroyStorage();
+
+    if (registry.contains(blockName)
+            && registry.at(blockName).expired()) {
+        registry.erase(blockName);
+    }
+
+    freeBindingPoints.insert(bindingPoint);
+}
+
+GLuint GLUniformBuffer::acquireBindingPoint() {
+    // Reuse lowest released point, so long-running apps stay in range
+    if (!freeBindingPoints.empty()) {
+        GLuint point = *freeBindingPoints.begin();
+        freeBindingPoints.erase(freeBindingPoints.begin());
+        return point;
+    }
+
+    return nextBindingPoint++;
+}
+
+GLuint GLUniformBuffer::getBindingPointCount() {
+    if (maxBindingPoints <= 0) {
+        glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxBindingPoints);
+    }
+    return static_cast<GLuint>(std::max(maxBindingPoints, 0));
+}
+
+bool GLUniformBuffer::attachProgram(GLuint programID) {
+    GLuint blockIndex = glGetProgramResourceIndex(
+        programID, GL_UNIFORM_BLOCK, blockName.c_str());
+    if (blockIndex == GL_INVALID_INDEX) return false;
+
+    if (bindingPoint >= getBindingPointCount()) {
+        logger.log(
+            fmt::format(LOG_BINDINGS_EXHAUSTED, blockName,
+                bindingPoint, getBindingPointCount()),
+            LogLevel::ERROR);
+        return false;
+    }
+
+    glUniformBlockBinding(programID, blockIndex, bindingPoint);
+
+    bool hasChanged = loadLayout(programID, blockIndex);
+    if (hasChanged || !bufferID) {
+        allocateStorage();
+    }
+
+    return true;
+}
+
+bool GLUniformBuffer::setUniform(std::shared_ptr<GLUniform> uniform) {
+    const std::string& name = uniform->getName();
+    if (!members.contains(name)) return false;
+
+    values[name] = uniform;
+    packUniform(members.at(name), uniform);
+
+    return true;
+}
+
+void GLUniformBuffer::commit() {
+    if (!isDirty || !mappedData) return;
+
+    // Guard the region in use by commands issued so far
+    if (fences.at(currentRegion)) {
+        glDeleteSync(fences.at(currentRegion));
+    }
+    fences.at(currentRegion) = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    currentRegion = (currentRegion + 1) % fences.size();
+
+    // Wait for GPU to finish reading from the next region
+    GLsync& fence = fences.at(currentRegion);
+    if (fence) {
+        GLenum result;
+        do {
+            result = glClientWaitSync(
+                fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+        } while (result == GL_TIMEOUT_EXPIRED);
+
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    std::size_t offset = currentRegion * regionSize;
+    std::memcpy(mappedData + offset, staging.data(), staging.size());
+    glBindBufferRange(GL_UNIFORM_BUFFER, bindingPoint,
+        bufferID, offset, staging.size());
+    BASIL_COUNT_GL_CALL(GLCallType::BUFFER_UPLOAD, staging.size());
+    BASIL_COUNT_GL_CALL(GLCallType::BIND);
+
+    isDirty = false;
+}
+
+std::optional<GLUniformBlockMember> GLUniformBuffer::getMember(
+        const std::string& name) const {
+    if (!members.contains(name)) return std::nullopt;
+
+    return std::optional(members.at(name));
+}
+
+bool GLUniformBuffer::loadLayout(GLuint programID, GLuint blockIndex) {
+    const GLenum blockProperties[] =
+        { GL_BUFFER_DATA_SIZE, GL_NUM_ACTIVE_VARIABLES };
+    GLint blockValues[2];
+    glGetProgramResourceiv(programID, GL_UNIFORM_BLOCK, blockIndex,
+        2, blockProperties, 2, nullptr, blockValues);
+
+    std::vector<GLint> indices(blockValues[1]);
+    const GLenum activeVariables = GL_ACTIVE_VARIABLES;
+    glGetProgramResourceiv(programID, GL_UNIFORM_BLOCK, blockIndex,
+        1, &activeVariables, indices.size(), nullptr, indices.data());
+
+    const GLenum properties[] = { GL_OFFSET, GL_TYPE, GL_ARRAY_SIZE,
+        GL_ARRAY_STRIDE, GL_MATRIX_STRIDE, GL_NAME_LENGTH };
+    std::map<std::string, GLUniformBlockMember> layout;
+
+    for (GLint index : indices) {
+        GLint values[6];
+        glGetProgramResourceiv(programID, GL_UNIFORM, index,
+            6, properties, 6, nullptr, values);
+
+        std::vector<char> nameBuffer(values[5] + 1, '\0');
+        glGetProgramResourceName(programID, GL_UNIFORM, index,
+            nameBuffer.size(), nullptr, nameBuffer.data());
+
+        GLUniformBlockMember member = {
+            .offset = static_cast<unsigned int>(values[0]),
+            .type = static_cast<GLenum>(values[1]),
+            .arraySize = static_cast<unsigned int>(values[2]),
+            .arrayStride = static_cast<unsigned int>(values[3]),
+            .matrixStride = static_cast<unsigned int>(values[4])
+        };
+
+        // Arrays are reported as "name[0]", and members of blocks
+        //  with an instance name as "BlockName.name"
+        std::string name(nameBuffer.data());
+        if (name.ends_with("[0]")) {
+            name.resize(name.size() - 3);
+        }
+        layout.emplace(name, member);
+
+        std::string prefix = blockName + ".";
+        if (name.starts_with(prefix)) {
+            layout.emplace(name.substr(prefix.size()), member);
+        }
+    }
+
+    std::size_t blockSize = blockValues[0];
+    bool hasChanged = blockSize != staging.size()
+        || layout.size() != members.size()
+        || !std::equal(layout.begin(), layout.end(), members.begin(),
+            [](const auto& first, const auto& second) {
+                return first.first == second.first
+                    && first.second.offset == second.second.offset
+                    && first.second.type == second.second.type
+                    && first.second.arraySize == second.second.arraySize;
+            });
+    if (!hasChanged) return false;
+
+    if (!members.empty()) {
+        logger.log(
+            fmt::format(LOG_LAYOUT_CHANGED, blockName, programID),
+            LogLevel::WARN);
+    }
+
+    members = layout;
+    staging.assign(blockSize, std::byte(0));
+
+    logger.log(
+        fmt::format(LOG_LAYOUT, blockName, blockSize,
+            indices.size(), programID),
+        LogLevel::DEBUG);
+
+    // Re-pack values against new layout
+    for (const auto& [name, uniform] : values) {
+        if (members.contains(name)) {
+            packUniform(members.at(name), uniform);
+        }
+    }
+
+    return true;
+}
+
+void GLUniformBuffer::allocateStorage() {
+    destroyStorage();
+
+    GLint alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    regionSize = ((staging.size() + alignment - 1) / alignment) * alignment;
+
+    std::size_t totalSize = regionSize * fences.size();
+    GLbitfield flags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glCreateBuffers(1, &bufferID);
+    glNamedBufferStorage(bufferID, totalSize, nullptr, flags);
+    mappedData = static_cast<std::byte*>(
+        glMapNamedBufferRange(bufferID, 0, totalSize, flags));
+
+    currentRegion = 0;
+    isDirty = true;
+}
+
+void GLUniformBuffer::destroyStorage() {
+    for (GLsync& fence : fences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (bufferID) {
+        glUnmapNamedBuffer(bufferID);
+        glDeleteBuffers(1, &bufferID);
+    }
+
+    bufferID = 0;
+    mappedData = nullptr;
+}
+
+bool GLUniformBuffer::packUniform(const GLUniformBlockMember& member,
+        std::shared_ptr<GLUniform> uniform) {
+    auto shape = getTypeShape(member.type);
+    unsigned int count = std::min(uniform->getCount(), member.arraySize);
+    if (!shape || count == 0
+            || uniform->getLength() != shape->rows
+            || uniform->getWidth() != shape->columns
+            || uniform->getDataSize() / uniform->getCount()
+                != shape->rows * shape->columns * shape->componentSize) {
+        if (errorHistory.insert(uniform->getName()).second) {
+            logger.log(
+                fmt::format(LOG_SHAPE_MISMATCH,
+                    blockName, uniform->getName()),
+                LogLevel::WARN);
+        }
+        return false;
+    }
+
+    const std::byte* source =
+        static_cast<const std::byte*>(uniform->getData());
+    std::size_t columnSize = shape->rows * shape->componentSize;
+
+    for (unsigned int element = 0; element < count; element++) {
+        for (unsigned int column = 0; column < shape->columns; column++) {
+            std::byte* destination = staging.data() + member.offset
+                + element * member.arrayStride
+                + column * member.matrixStride;
+            const std::byte* columnSource = source
+                + (element * shape->columns + column) * columnSize;
+
+            if (std::memcmp(destination, columnSource, columnSize) != 0) {
+                std::memcpy(destination, columnSource, columnSize);
+                isDirty = true;
+            }
+        }
+    }
+
+    return true;
+}
+
+std::optional<GLUniformBuffer::TypeShape> GLUniformBuffer::getTypeShape(
+        GLenum type) {
+    switch (type) {
+        case GL_FLOAT: case GL_INT: case GL_UNSIGNED_INT: case GL_BOOL:
+            return TypeShape { 1, 1, 4 };
+        case GL_FLOAT_VEC2: case GL_INT_VEC2:
+        case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2:
+            return TypeShape { 1, 2, 4 };
+        case GL_FLOAT_VEC3: case GL_INT_VEC3:
+        case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3:
+            return TypeShape { 1, 3, 4 };
+        case GL_FLOAT_VEC4: case GL_INT_VEC4:
+        case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4:
+            return TypeShape { 1, 4, 4 };
+        case GL_FLOAT_MAT2:     return TypeShape { 2, 2, 4 };
+        case GL_FLOAT_MAT2x3:   return TypeShape { 2, 3, 4 };
+        case GL_FLOAT_MAT2x4:   return TypeShape { 2, 4, 4 };
+        case GL_FLOAT_MAT3x2:   return TypeShape { 3, 2, 4 };
+        case GL_FLOAT_MAT3:     return TypeShape { 3, 3, 4 };
+        case GL_FLOAT_MAT3x4:   return TypeShape { 3, 4, 4 };
+        case GL_FLOAT_MAT4x2:   return TypeShape { 4, 2, 4 };
+        case GL_FLOAT_MAT4x3:   return TypeShape { 4, 3, 4 };
+        case GL_FLOAT_MAT4:     return TypeShape { 4, 4, 4 };
+        default:
+            return std::nullopt;
+    }
+}
+
+}  // namespace basil
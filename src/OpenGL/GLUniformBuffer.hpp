@@ -0,0 +1,153 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <Basil/Packages/Context.hpp>
+#include <Basil/Packages/Logging.hpp>
+
+#include "GLUniform.hpp"
+
+namespace basil {
+
+/** @brief Layout of a single member within a std140 uniform block */
+struct GLUniformBlockMember {
+    /** @brief Byte offset of member from start of block */
+    unsigned int offset = 0;
+
+    /** @brief OpenGL type enum, e.g. GL_FLOAT_VEC3 */
+    GLenum type = 0;
+
+    /** @brief Number of array elements, or 1 for non-arrays */
+    unsigned int arraySize = 1;
+
+    /** @brief Bytes between consecutive array elements */
+    unsigned int arrayStride = 0;
+
+    /** @brief Bytes between consecutive matrix columns */
+    unsigned int matrixStride = 0;
+};
+
+/** @brief Persistently mapped, multi-buffered uniform buffer object
+ *  backing a named uniform block. One buffer is shared by every
+ *  shader program which declares a block of the same name. */
+class GLUniformBuffer : private IBasilContextConsumer {
+ public:
+    /** @returns Shared buffer for block name, created if needed */
+    static std::shared_ptr<GLUniformBuffer> forBlock(
+        const std::string& blockName);
+
+    /** @brief Create buffer for block name. Storage is allocated once
+     *  a program declaring the block is attached. */
+    explicit GLUniformBuffer(const std::string& blockName);
+
+    /** @brief Unmap buffer, tear down OpenGL memory and release
+     *  binding point for reuse */
+    ~GLUniformBuffer();
+
+    /** @brief Bind block in program to this buffer, taking the block
+     *  layout from the program if not yet known. Must be repeated
+     *  after each link of the program.
+     *  @returns Whether program declares the block, and the buffer's
+     *  binding point is within GL_MAX_UNIFORM_BUFFER_BINDINGS */
+    bool attachProgram(GLuint programID);
+
+    /** @returns Whether block contains member with uniform name */
+    bool hasMember(const std::string& name) const {
+        return members.contains(name);
+    }
+
+    /** @brief Pack uniform value into block, marking buffer as
+     *  changed if the packed bytes differ from the current value.
+     *  @returns Whether block contains member with uniform name */
+    bool setUniform(std::shared_ptr<GLUniform> uniform);
+
+    /** @brief Write changed values into the next buffer region and
+     *  bind it to the block's binding point. No-op if unchanged. */
+    void commit();
+
+    /** @returns Name of uniform block */
+    const std::string& getBlockName() const { return blockName; }
+
+    /** @returns Binding point assigned to block */
+    GLuint getBindingPoint() const { return bindingPoint; }
+
+    /** @returns OpenGL ID of buffer object */
+    GLuint getID() const { return bufferID; }
+
+    /** @returns Size in bytes of block data */
+    std::size_t getBlockSize() const { return staging.size(); }
+
+    /** @returns Layout of member with name, if found */
+    std::optional<GLUniformBlockMember> getMember(
+        const std::string& name) const;
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    struct TypeShape {
+        unsigned int columns;
+        unsigned int rows;
+        unsigned int componentSize;
+    };
+
+    static std::optional<TypeShape> getTypeShape(GLenum type);
+
+    static GLuint acquireBindingPoint();
+    static GLuint getBindingPointCount();
+
+    bool loadLayout(GLuint programID, GLuint blockIndex);
+    void allocateStorage();
+    void destroyStorage();
+
+    bool packUniform(const GLUniformBlockMember& member,
+        std::shared_ptr<GLUniform> uniform);
+
+    std::string blockName;
+    GLuint bindingPoint;
+
+    std::map<std::string, GLUniformBlockMember> members;
+    std::map<std::string, std::shared_ptr<GLUniform>> values;
+
+    std::set<std::string> errorHistory;
+
+    std::vector<std::byte> staging;
+    bool isDirty = false;
+
+    GLuint bufferID = 0;
+    std::byte* mappedData = nullptr;
+    std::size_t regionSize = 0;
+    unsigned int currentRegion = 0;
+    std::vector<GLsync> fences;
+
+    Logger& logger = Logger::get();
+
+    static inline GLuint nextBindingPoint = 0;
+    static inline std::set<GLuint> freeBindingPoints;
+    static inline GLint maxBindingPoints = 0;
+    static inline std::map<std::string,
+        std::weak_ptr<GLUniformBuffer>> registry;
+
+    LOGGER_FORMAT LOG_BINDINGS_EXHAUSTED =
+        "Uniform Buffer \"{}\" - Binding point {} exceeds limit of {} "
+        "uniform buffer bindings.";
+    LOGGER_FORMAT LOG_LAYOUT =
+        "Uniform Buffer \"{}\" - Loaded block layout of {} bytes, "
+        "{} members, from program (ID{:02}).";
+    LOGGER_FORMAT LOG_LAYOUT_CHANGED =
+        "Uniform Buffer \"{}\" - Block layout in program (ID{:02}) differs "
+        "from previous layout. Other programs may read invalid data.";
+    LOGGER_FORMAT LOG_SHAPE_MISMATCH =
+        "Uniform Buffer \"{}\" - Uniform \"{}\" does not match shape "
+        "of block member.";
+};
+
+}   // namespace basil
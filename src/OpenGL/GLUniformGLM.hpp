@@ -0,0 +1,32 @@
+#pragma once
+
+#if __has_include(<glm/glm.hpp>)
+
+#include <glm/glm.hpp>
+
+#include "GLUniform.hpp"
+
+namespace basil {
+
+/** @brief Shape of glm vector types, e.g. glm::vec3 or glm::dvec4 */
+template<glm::length_t L, class T, glm::qualifier Q>
+struct GLUniformShape<glm::vec<L, T, Q>> {
+    using Element = T;
+    static constexpr unsigned int Length = L;
+    static constexpr unsigned int Width = 1;
+    static constexpr unsigned int Count = 1;
+};
+
+/** @brief Shape of glm matrix types, e.g. glm::mat4 or glm::dmat2x3.
+ *  glm stores C columns of R rows, matching GLSL matCxR. */
+template<glm::length_t C, glm::length_t R, class T, glm::qualifier Q>
+struct GLUniformShape<glm::mat<C, R, T, Q>> {
+    using Element = T;
+    static constexpr unsigned int Length = R;
+    static constexpr unsigned int Width = C;
+    static constexpr unsigned int Count = 1;
+};
+
+}   // namespace basil
+
+#endif
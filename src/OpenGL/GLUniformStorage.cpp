@@ -0,0 +1,67 @@
+#include "GLUniformStorage.hpp"
+
+#include <algorithm>
+
+#include "Process/GLCallMetrics.hpp"
+
+namespace basil {
+
+GLUniformStorage::~GLUniformStorage() {
+    if (bufferID) {
+        glDeleteBuffers(1, &bufferID);
+    }
+}
+
+bool GLUniformStorage::updateBytes(
+        std::span<const std::byte> bytes, std::size_t offset) {
+    if (offset > storage.size() || bytes.size() > storage.size() - offset) {
+        return false;
+    }
+    if (bytes.empty()) return true;
+
+    std::memcpy(storage.data() + offset, bytes.data(), bytes.size());
+
+    if (dirtyBegin < dirtyEnd) {
+        dirtyBegin = std::min(dirtyBegin, offset);
+        dirtyEnd = std::max(dirtyEnd, offset + bytes.size());
+    } else {
+        dirtyBegin = offset;
+        dirtyEnd = offset + bytes.size();
+    }
+
+    return true;
+}
+
+void GLUniformStorage::setData(std::span<const std::byte> bytes) {
+    if (bytes.size() != storage.size()) {
+        needsAllocation = true;
+    }
+
+    storage.assign(bytes.begin(), bytes.end());
+    dirtyBegin = 0;
+    dirtyEnd = storage.size();
+}
+
+GLuint GLUniformStorage::upload() {
+    if (!bufferID) {
+        glCreateBuffers(1, &bufferID);
+        needsAllocation = true;
+    }
+
+    if (needsAllocation) {
+        glNamedBufferData(bufferID, storage.size(),
+            storage.data(), GL_DYNAMIC_DRAW);
+        BASIL_COUNT_GL_CALL(GLCallType::BUFFER_UPLOAD, storage.size());
+    } else if (dirtyBegin < dirtyEnd) {
+        glNamedBufferSubData(bufferID, dirtyBegin,
+            dirtyEnd - dirtyBegin, storage.data() + dirtyBegin);
+        BASIL_COUNT_GL_CALL(GLCallType::BUFFER_UPLOAD, dirtyEnd - dirtyBegin);
+    }
+
+    needsAllocation = false;
+    dirtyBegin = dirtyEnd = 0;
+
+    return bufferID;
+}
+
+}  // namespace basil
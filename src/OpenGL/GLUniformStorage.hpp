@@ -0,0 +1,112 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "GLUniform.hpp"
+
+namespace basil {
+
+/** @brief Concept restricting element types of shader storage blocks */
+template<class T>
+concept GLStorageType = std::is_trivially_copyable_v<T>;
+
+/** @brief Implementation of GLUniform containing the data of a shader
+ *  storage block. Values are copied into a shader storage buffer
+ *  object when first bound, and only changed byte ranges are copied
+ *  after that. Unlike GLUniformVector, size is not limited by the
+ *  number of uniform components available to the shader.
+ *
+ *  @details The uniform name is the name of the storage block. Data
+ *  is copied as-is, so elements must match the std430 layout of the
+ *  block, e.g. vec3 members are padded to 16 bytes. */
+class GLUniformStorage : public GLUniform {
+ public:
+    /** @brief Constructs GLUniform wrapper from element values
+     *  @param values       Values of storage block elements
+     *  @param blockName    Storage block name in shader code */
+    template<GLStorageType T>
+    GLUniformStorage(
+            std::span<const T> values,
+            const std::string& blockName)
+        : GLUniform(GLUniformSource<unsigned int>(nullptr), blockName,
+            1, 1, 0) {
+        setValues(values);
+    }
+
+    /** @brief Constructs GLUniform wrapper from element values
+     *  @param values       Vector of storage block elements
+     *  @param blockName    Storage block name in shader code */
+    template<GLStorageType T>
+    GLUniformStorage(
+            const std::vector<T>& values,
+            const std::string& blockName)
+        : GLUniformStorage(std::span<const T>(values), blockName) {}
+
+    /** @brief Deletes shader storage buffer object, if created */
+    ~GLUniformStorage();
+
+    GLUniformStorage(const GLUniformStorage&) = delete;
+    GLUniformStorage& operator=(const GLUniformStorage&) = delete;
+
+    /** @brief Overwrites a range of elements, starting at firstElement.
+     *  Only the overwritten range is copied on the next upload.
+     *  @returns Whether range lies within current data */
+    template<GLStorageType T>
+    bool updateRange(std::span<const T> values, std::size_t firstElement = 0) {
+        return updateBytes(std::as_bytes(values), firstElement * sizeof(T));
+    }
+
+    /** @brief Replaces all elements, reallocating buffer if size changed */
+    template<GLStorageType T>
+    void setValues(std::span<const T> values) {
+        this->count = values.size();
+        setData(std::as_bytes(values));
+    }
+
+    /** @brief Overwrites a range of bytes, starting at offset.
+     *  @returns Whether range lies within current data */
+    bool updateBytes(std::span<const std::byte> bytes, std::size_t offset);
+
+    /** @brief Replaces all data, reallocating buffer if size changed */
+    void setData(std::span<const std::byte> bytes);
+
+    /** @returns Size of storage block data in bytes */
+    std::size_t getStorageSize() const { return storage.size(); }
+
+    /** @returns Pointer to storage block data */
+    const std::byte* getStorageData() const { return storage.data(); }
+
+    /** @returns Whether data has changed since last upload */
+    bool hasPendingUpload() const {
+        return needsAllocation || dirtyBegin < dirtyEnd;
+    }
+
+    /** @brief Creates buffer object if needed, and copies changed
+     *  ranges into it. Requires an active OpenGL context.
+     *  @returns OpenGL ID of buffer object */
+    GLuint upload();
+
+    /** @returns OpenGL ID of buffer object, or 0 if not uploaded */
+    GLuint getBufferID() const { return bufferID; }
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    std::vector<std::byte> storage;
+
+    std::size_t dirtyBegin = 0;
+    std::size_t dirtyEnd = 0;
+    bool needsAllocation = true;
+
+    GLuint bufferID = 0;
+};
+
+}   // namespace basil
@@ -1,5 +1,13 @@
+#include <fmt/format.h>
+
+#include <algorithm>
+
 #include "HotReloadShaderPane.hpp"
 
+#include "GLShaderPermutationCache.hpp"
+
+#include "Process/EventMetrics.hpp"
+
 namespace basil {
 
 HotReloadShaderPane::HotReloadShaderPane() {
@@ -18,7 +26,12 @@ HotReloadShaderPane::HotReloadShaderPane(std::filesystem::path shaderFilePath)
 
 void HotReloadShaderPane::setFilePath(std::filesystem::path shaderFilePath) {
     filePath = shaderFilePath;
+    fileWatches = { FileWatchService::get().watch(filePath) };
     updateShader();
+
+    if (pendingProgram) {
+        applyPendingProgram();
+    }
 }
 
 void HotReloadShaderPane::draw() {
@@ -27,22 +40,81 @@ void HotReloadShaderPane::draw() {
 }
 
 void HotReloadShaderPane::updateShader() {
-    if (!std::filesystem::exists(filePath)) {
-        useDefaultShader();
-        return;
+    // Only touch the file system once a watch reports a change
+    bool hasChanged = false;
+    for (const auto& fileWatch : fileWatches) {
+        hasChanged |= fileWatch->hasChanged();
+    }
+
+    if (hasChanged) {
+        if (!std::filesystem::exists(filePath)) {
+            pendingProgram = nullptr;
+            pendingFrag = nullptr;
+            useDefaultShader();
+            return;
+        }
+
+        compilePendingProgram();
     }
 
-    auto writeTime = std::filesystem::last_write_time(filePath);
-    if (writeTime > timestamp) {
-        timestamp = writeTime;
-        auto fragmentFromFile = std::make_shared<GLFragmentShader>(filePath);
+    if (pendingProgram
+            && pendingFrag->isCompileComplete()
+            && pendingProgram->isLinkComplete()) {
+        applyPendingProgram();
+    }
+}
+
+void HotReloadShaderPane::compilePendingProgram() {
+    compileStartTime = FrameClock::now();
+
+    // Replaces any earlier build which has not finished
+    pendingFrag = GLShaderPermutationCache::get().getFragmentShader(
+        filePath, {}, GLShader::CompileMode::PARALLEL);
+    pendingProgram = std::make_shared<GLShaderProgram>(
+        defaultVert, pendingFrag, GLShader::CompileMode::PARALLEL);
 
-        if (fragmentFromFile->hasCompiledSuccessfully()) {
-            currentShaderProgram->setFragmentShader(fragmentFromFile);
+    watchDependencies(pendingFrag->getDependencies());
+}
+
+void HotReloadShaderPane::watchDependencies(
+        const std::vector<std::filesystem::path>& dependencies) {
+    // Keep previous watches if the shader could not be read
+    if (dependencies.empty() || fileWatches.empty()) return;
+
+    // The first watch is always on the shader file itself
+    std::vector<std::shared_ptr<FileWatch>> watches = { fileWatches.front() };
+    for (std::size_t i = 1; i < dependencies.size(); i++) {
+        auto found = std::find_if(fileWatches.begin(), fileWatches.end(),
+            [&](const auto& fileWatch) {
+                return fileWatch->getPath() == dependencies[i];
+            });
+
+        if (found != fileWatches.end()) {
+            watches.push_back(*found);
         } else {
-            useDefaultShader();
+            // The include has just been read, so skip the initial change
+            watches.push_back(FileWatchService::get().watch(dependencies[i]));
+            watches.back()->hasChanged();
         }
     }
+    fileWatches = std::move(watches);
+}
+
+void HotReloadShaderPane::applyPendingProgram() {
+    auto program = std::move(pendingProgram);
+    auto fragment = std::move(pendingFrag);
+
+    if (fragment->hasCompiledSuccessfully()
+            && program->hasLinkedSuccessfully()) {
+        program->copyUniformsFrom(*currentShaderProgram);
+        setShaderProgram(program);
+    } else {
+        useDefaultShader();
+    }
+
+    EventMetrics::get().recordEvent(
+        fmt::format(COMPILE_EVENT, filePath.filename().string()),
+        FrameClock::now() - compileStartTime);
 }
 
 void HotReloadShaderPane::useDefaultShader() {
@@ -58,4 +130,11 @@ HotReloadShaderPane::Builder::fromFilePath(
     return (*this);
 }
 
+HotReloadShaderPane::Builder&
+HotReloadShaderPane::Builder::withFrozenUniform(const std::string& name) {
+    // Reloaded programs copy frozen uniforms from the current program
+    this->impl->currentShaderProgram->freezeUniform(name);
+    return (*this);
+}
+
 }  // namespace basil
@@ -2,26 +2,35 @@
 
 #include <filesystem>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <Basil/Packages/Builder.hpp>
+#include <Basil/Packages/Chrono.hpp>
 
+#include "File/FileWatchService.hpp"
 #include "Window/IPane.hpp"
 
 #include "GLShaderPane.hpp"
 
 namespace basil {
 
-/** @brief Pane which automatically reloads modified fragment shaders. */
+/** @brief Pane which automatically reloads modified fragment shaders.
+ *  Changes to the shader or its includes are detected by
+ *  FileWatchService, off the render thread.
+ *  Modified shaders are compiled in parallel where the driver supports
+ *  it, and the previous shader is drawn until the new one has linked. */
 class HotReloadShaderPane : public GLShaderPane,
                             public IBuildable<HotReloadShaderPane> {
  public:
     /** @brief Initialize from file path. */
     HotReloadShaderPane(std::filesystem::path shaderFilePath);
 
-    /** @brief Set path of shader file. */
+    /** @brief Set path of shader file, and wait for it to compile. */
     void setFilePath(std::filesystem::path shaderFilePath);
 
-    /** @brief Check for file update and draw to screen. */
+    /** @brief Check for file update, swap in the modified shader once
+     *  it has linked, and draw to screen. */
     void draw() override;
 
     /** @brief Builder pattern for HotReloadShaderPane. */
@@ -29,6 +38,10 @@ class HotReloadShaderPane : public GLShaderPane,
      public:
         /** @brief Build with fragment shader at given file path. */
         Builder& fromFilePath(std::filesystem::path shaderFilePath);
+
+        /** @brief Freeze uniform in every reloaded shader program,
+         *  see GLShaderProgram::freezeUniform. */
+        Builder& withFrozenUniform(const std::string& name);
     };
 
 #ifndef TEST_BUILD
@@ -38,17 +51,27 @@ class HotReloadShaderPane : public GLShaderPane,
     void updateShader();
     void useDefaultShader();
 
+    void compilePendingProgram();
+    void applyPendingProgram();
+    void watchDependencies(
+        const std::vector<std::filesystem::path>& dependencies);
+
     friend class IBuilder<HotReloadShaderPane>;
     HotReloadShaderPane();
 
     std::filesystem::path filePath;
-    std::filesystem::file_time_type timestamp
-        = std::filesystem::file_time_type::min();
+    std::vector<std::shared_ptr<FileWatch>> fileWatches;
 
     std::shared_ptr<GLVertexShader> defaultVert
         = GLVertexShader::noOpShader();
     std::shared_ptr<GLFragmentShader> defaultFrag
         = GLFragmentShader::debugShader();
+
+    std::shared_ptr<GLFragmentShader> pendingFrag = nullptr;
+    std::shared_ptr<GLShaderProgram> pendingProgram = nullptr;
+    FrameClock::time_point compileStartTime;
+
+    LOGGER_FORMAT COMPILE_EVENT = "Compile {}";
 };
 
 }   // namespace basil
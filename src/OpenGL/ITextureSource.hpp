@@ -1,11 +1,20 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include "GLTextureFormat.hpp"
 
 namespace basil {
 
+/** @brief Box within texture, in pixels. Unused dimensions of 1D and
+ *  2D textures have offset 0 and size 1. */
+struct TextureRegion {
+    std::array<int, 3> offset = { 0, 0, 0 };
+    std::array<int, 3> size = { 1, 1, 1 };
+};
+
 /**
  * @brief Interface for container of data which can be used in GLTexture
  *
@@ -37,6 +46,26 @@ class ITextureSource {
     /** @brief Provides pointer to data in memory. */
     virtual const void* data() = 0;
 
+    /** @brief Marks region as changed since last update, so that only
+     *  marked regions are uploaded. If no region is marked, the whole
+     *  texture is uploaded.
+     *  @param offset   Position of first pixel in region
+     *  @param size     Size of region, in pixels */
+    void markDirty(std::array<int, N> offset, std::array<int, N> size) {
+        TextureRegion region;
+        std::copy(offset.begin(), offset.end(), region.offset.begin());
+        std::copy(size.begin(), size.end(), region.size.begin());
+        dirtyRegions.push_back(region);
+    }
+
+    /** @returns Regions marked as changed since last update. */
+    const std::vector<TextureRegion>& getDirtyRegions() {
+        return dirtyRegions;
+    }
+
+    /** @brief Clears marked regions, once they have been uploaded. */
+    void clearDirtyRegions() { dirtyRegions.clear(); }
+
     /** @brief Struct containing OpenGL data type information. */
     GLTextureFormat format;
 
@@ -45,6 +74,7 @@ class ITextureSource {
  protected:
 #endif
     std::array<int, N> dimension = { 0 };
+    std::vector<TextureRegion> dirtyRegions;
 };
 
 using ITextureSource1D = ITextureSource<1>;
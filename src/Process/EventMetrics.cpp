@@ -0,0 +1,33 @@
+#include "EventMetrics.hpp"
+
+#include <utility>
+
+namespace basil {
+
+EventMetric EventMetric::operator+(const EventMetric& addend) const {
+    return EventMetric {
+        .eventCount = eventCount + addend.eventCount,
+        .totalTime = totalTime + addend.totalTime
+    };
+}
+
+EventMetric EventMetric::operator-(const EventMetric& subtrahend) const {
+    return EventMetric {
+        .eventCount = eventCount - subtrahend.eventCount,
+        .totalTime = totalTime - subtrahend.totalTime
+    };
+}
+
+void EventMetrics::recordEvent(
+        const std::string& eventName,
+        FrameClock::duration duration) {
+    EventMetric& metric = entries[eventName];
+    metric.eventCount += 1;
+    metric.totalTime += duration;
+}
+
+std::map<std::string, EventMetric> EventMetrics::flush() {
+    return std::exchange(entries, {});
+}
+
+}  // namespace basil
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <Basil/Packages/Chrono.hpp>
+
+namespace basil {
+
+/** @brief Count and total duration of a named event, e.g. a shader
+ *  compilation, which happens outside of the regular process loop. */
+struct EventMetric {
+    /** @brief Number of times event occurred. */
+    unsigned int eventCount = 0;
+
+    /** @brief Duration of event, summed over occurrences. */
+    FrameClock::duration totalTime = FrameClock::duration::zero();
+
+    EventMetric operator+(const EventMetric& addend) const;
+    EventMetric operator-(const EventMetric& subtrahend) const;
+
+    bool operator==(const EventMetric& comparison) const = default;
+};
+
+/** @brief Global collector of event durations, using Singleton pattern.
+ *  Events are collected into the MetricsRecord of the current frame. */
+class EventMetrics {
+ public:
+    /** @return Instance of Singleton collector. */
+    static EventMetrics& get() {
+        static EventMetrics instance;
+        return instance;
+    }
+
+    /** @brief Record a single occurrence of event.
+     *  @param eventName    Readable name of event
+     *  @param duration     Time taken by event */
+    void recordEvent(
+        const std::string& eventName,
+        FrameClock::duration duration);
+
+    /** @brief Collects events recorded since the last flush.
+     *  @returns Map of event metrics by name. */
+    std::map<std::string, EventMetric> flush();
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    EventMetrics() = default;
+
+    std::map<std::string, EventMetric> entries;
+};
+
+}   // namespace basil
@@ -0,0 +1,58 @@
+#include "GLCallMetrics.hpp"
+
+namespace basil {
+
+GLCallMetric GLCallMetric::operator+(const GLCallMetric& addend) const {
+    return GLCallMetric {
+        .callCount = callCount + addend.callCount,
+        .bytes = bytes + addend.bytes
+    };
+}
+
+GLCallMetric GLCallMetric::operator-(
+        const GLCallMetric& subtrahend) const {
+    return GLCallMetric {
+        .callCount = callCount - subtrahend.callCount,
+        .bytes = bytes - subtrahend.bytes
+    };
+}
+
+GLCallMetric GLCallMetric::operator/(int divisor) const {
+    return GLCallMetric {
+        .callCount = callCount / divisor,
+        .bytes = bytes / divisor
+    };
+}
+
+void GLCallMetrics::recordCall(GLCallType type, std::size_t bytes) {
+    GLCallMetric& metric = entries.at(static_cast<std::size_t>(type));
+    metric.callCount += 1;
+    metric.bytes += bytes;
+}
+
+std::map<GLCallType, GLCallMetric> GLCallMetrics::flush() {
+    std::map<GLCallType, GLCallMetric> result;
+
+    for (std::size_t index = 0; index < TYPE_COUNT; index++) {
+        if (entries.at(index).callCount > 0) {
+            result[static_cast<GLCallType>(index)] = entries.at(index);
+        }
+    }
+
+    entries = {};
+    return result;
+}
+
+std::string_view GLCallMetrics::getTypeName(GLCallType type) {
+    switch (type) {
+        case GLCallType::DRAW:              return "draw";
+        case GLCallType::UNIFORM:           return "uniform";
+        case GLCallType::BIND:              return "bind";
+        case GLCallType::TEXTURE_UPLOAD:    return "texture upload";
+        case GLCallType::BUFFER_UPLOAD:     return "buffer upload";
+        case GLCallType::READBACK:          return "readback";
+    }
+    return "unknown";
+}
+
+}  // namespace basil
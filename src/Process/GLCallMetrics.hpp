@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <string_view>
+
+#include "Definitions.hpp"
+
+namespace basil {
+
+/** @brief Category of OpenGL API call counted by GLCallMetrics. BIND
+ *  also covers other state changes, e.g. of the viewport. */
+enum class GLCallType {
+    DRAW, UNIFORM, BIND, TEXTURE_UPLOAD, BUFFER_UPLOAD, READBACK
+};
+
+/** @brief Number of calls of one category, with bytes transferred. */
+struct GLCallMetric {
+    /** @brief Number of calls issued to OpenGL. */
+    unsigned int callCount = 0;
+
+    /** @brief Bytes sent to or read from OpenGL, summed over calls. */
+    std::size_t bytes = 0;
+
+    GLCallMetric operator+(const GLCallMetric& addend) const;
+    GLCallMetric operator-(const GLCallMetric& subtrahend) const;
+    GLCallMetric operator/(int divisor) const;
+
+    bool operator==(const GLCallMetric& comparison) const = default;
+};
+
+/** @brief Global collector of OpenGL call counters, using Singleton
+ *  pattern. Calls are only recorded when compiled with
+ *  BASIL_GL_CALL_COUNTING, through BASIL_COUNT_GL_CALL, so that
+ *  counting costs nothing otherwise. */
+class GLCallMetrics {
+ public:
+    /** @return Instance of Singleton collector. */
+    static GLCallMetrics& get() {
+        static GLCallMetrics instance;
+        return instance;
+    }
+
+    /** @return Whether calls are counted in this build. */
+    static constexpr bool isEnabled() { return BASIL_GL_CALL_COUNTING; }
+
+    /** @brief Record a single call.
+     *  @param type     Category of call
+     *  @param bytes    Bytes transferred by call, if any */
+    void recordCall(GLCallType type, std::size_t bytes = 0);
+
+    /** @brief Collects calls recorded since the last flush.
+     *  @returns Map of counters by category, without empty categories */
+    std::map<GLCallType, GLCallMetric> flush();
+
+    /** @returns Human-readable name of category. */
+    static std::string_view getTypeName(GLCallType type);
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    GLCallMetrics() = default;
+
+    static constexpr std::size_t TYPE_COUNT =
+        static_cast<std::size_t>(GLCallType::READBACK) + 1;
+
+    std::array<GLCallMetric, TYPE_COUNT> entries = {};
+};
+
+}   // namespace basil
+
+#if BASIL_GL_CALL_COUNTING
+    #define BASIL_COUNT_GL_CALL(...) \
+        basil::GLCallMetrics::get().recordCall(__VA_ARGS__)
+#else
+    #define BASIL_COUNT_GL_CALL(...) ((void) 0)
+#endif
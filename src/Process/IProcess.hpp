@@ -37,7 +37,7 @@ class IProcess {
     virtual void onStop() {}
 
     /** @return Name of process instance. */
-    std::optional<std::string> getProcessName() {
+    std::optional<std::string> getProcessName() const {
         return processName;
     }
 
@@ -19,6 +19,9 @@ void MetricsObserver::recordWorkEnd(FrameClock::time_point workEndTime) {
 
 void MetricsObserver::recordFrameEnd(FrameClock::time_point frameEndTime) {
     current.frameTime = frameEndTime - frameStartTime;
+    current.messageMetrics = PubSubMetrics::get().flush();
+    current.eventMetrics = EventMetrics::get().flush();
+    current.glCallMetrics = GLCallMetrics::get().flush();
     pushFrameToBuffer();
 }
 
@@ -26,7 +26,9 @@ class MetricsObserver {
     void recordWorkEnd(
         FrameClock::time_point workEndTime);
 
-    /** @brief Record the time taken for entire frame. */
+    /** @brief Record the time taken for entire frame, and collect
+     *  PubSub message counters, events and OpenGL call counters for
+     *  the frame. */
     void recordFrameEnd(
         FrameClock::time_point frameEndTime);
 
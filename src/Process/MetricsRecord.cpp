@@ -23,6 +23,21 @@ MetricsRecord MetricsRecord::operator+(MetricsRecord addend) {
         }
     }
 
+    for (auto message : addend.messageMetrics) {
+        this->messageMetrics[message.first] =
+            this->messageMetrics[message.first] + message.second;
+    }
+
+    for (auto event : addend.eventMetrics) {
+        this->eventMetrics[event.first] =
+            this->eventMetrics[event.first] + event.second;
+    }
+
+    for (auto call : addend.glCallMetrics) {
+        this->glCallMetrics[call.first] =
+            this->glCallMetrics[call.first] + call.second;
+    }
+
     return *this;
 }
 
@@ -41,6 +56,30 @@ MetricsRecord MetricsRecord::operator-(MetricsRecord subtrahend) {
                 : FrameClock::duration::zero();
     }
 
+    for (auto message : messageMetrics) {
+        if (subtrahend.messageMetrics.contains(message.first)) {
+            this->messageMetrics[message.first] = message.second
+                - subtrahend.messageMetrics[message.first];
+        }
+    }
+
+    for (auto event : subtrahend.eventMetrics) {
+        if (!this->eventMetrics.contains(event.first)) continue;
+
+        EventMetric& metric = this->eventMetrics[event.first];
+        metric = metric - event.second;
+        if (metric.eventCount == 0) {
+            this->eventMetrics.erase(event.first);
+        }
+    }
+
+    for (auto call : glCallMetrics) {
+        if (subtrahend.glCallMetrics.contains(call.first)) {
+            this->glCallMetrics[call.first] = call.second
+                - subtrahend.glCallMetrics[call.first];
+        }
+    }
+
     return *this;
 }
 
@@ -52,6 +91,14 @@ MetricsRecord MetricsRecord::operator/(int divisor) {
         this->processTimes[process.first] = process.second / divisor;
     }
 
+    for (auto message : messageMetrics) {
+        this->messageMetrics[message.first] = message.second / divisor;
+    }
+
+    for (auto call : glCallMetrics) {
+        this->glCallMetrics[call.first] = call.second / divisor;
+    }
+
     return *this;
 }
 
@@ -66,7 +113,12 @@ bool MetricsRecord::isEqual(const MetricsRecord& comparison) {
             && std::equal(processTimes.begin(), processTimes.end(),
                           comparison.processTimes.begin());
 
-    return samePrimitives && sameMap;
+    bool sameMessages = messageMetrics == comparison.messageMetrics;
+    bool sameEvents = eventMetrics == comparison.eventMetrics;
+    bool sameCalls = glCallMetrics == comparison.glCallMetrics;
+
+    return samePrimitives && sameMap && sameMessages && sameEvents
+        && sameCalls;
 }
 
 double MetricsRecord::getFrameRate() {
@@ -4,7 +4,10 @@
 #include <memory>
 
 #include <Basil/Packages/Chrono.hpp>
+#include <Basil/Packages/PubSub.hpp>
 
+#include "EventMetrics.hpp"
+#include "GLCallMetrics.hpp"
 #include "ProcessInstance.hpp"
 
 namespace basil {
@@ -28,6 +31,18 @@ struct MetricsRecord {
     std::map<std::shared_ptr<ProcessInstance>,
         FrameClock::duration> processTimes;
 
+    /** @brief Map of PubSub message counters, by publisher and type.
+     *  Only populated while PubSubMetrics is enabled. */
+    std::map<MessageMetricsKey, MessageMetrics> messageMetrics;
+
+    /** @brief Map of events recorded through EventMetrics, by name.
+     *  Events are rare, so are totalled rather than averaged. */
+    std::map<std::string, EventMetric> eventMetrics;
+
+    /** @brief Map of OpenGL call counters, by category. Only populated
+     *  when built with BASIL_GL_CALL_COUNTING. */
+    std::map<GLCallType, GLCallMetric> glCallMetrics;
+
     /** @return Current frame rate calculated from the period. */
     double getFrameRate();
 
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <any>
+#include <cstddef>
 #include <memory>
 #include <optional>
+#include <typeinfo>
 
 namespace basil {
 
@@ -12,6 +14,10 @@ class DataMessage {
     /** @brief Initialize DataMessage from any type */
     explicit DataMessage(const std::any& data) : data(data) {}
 
+    /** @brief Initialize DataMessage from value of type T */
+    template<class T>
+    explicit DataMessage(const T& data) : data(data), dataSize(sizeof(T)) {}
+
     /** @brief Attempt to coerce DatamMessage to type T
      *  @returns Optional containing message casted to T,
      *           or nullopt if not castable. */
@@ -32,8 +38,32 @@ class DataMessage {
         }
     }
 
+    /** @brief Attempt to view DataMessage as type T, without copying
+     *  @returns Pointer to message contents as T, or nullptr if not
+     *           castable. Valid for the lifetime of the message. */
+    template<class T>
+    const T* getDataPointer() const {
+        if (const T* result = std::any_cast<T>(&data)) {
+            return result;
+        }
+
+        if (auto result = std::any_cast<std::shared_ptr<T>>(&data)) {
+            return result->get();
+        }
+
+        return nullptr;
+    }
+
+    /** @returns Type information of message payload */
+    const std::type_info& getType() const { return data.type(); }
+
+    /** @returns Shallow size of message payload in bytes,
+     *           or zero if unknown */
+    std::size_t getSize() const { return dataSize; }
+
  private:
     std::any data;
+    std::size_t dataSize = 0;
 };
 
 }   // namespace basil
@@ -2,9 +2,13 @@
 
 #include <memory>
 #include <set>
+#include <string>
+
+#include <Basil/Packages/Chrono.hpp>
 
 #include "DataMessage.hpp"
 #include "IDataSubscriber.hpp"
+#include "PubSubMetrics.hpp"
 
 namespace basil {
 
@@ -13,9 +17,27 @@ class IDataPublisher {
  public:
     /** @brief Send data model to subscribers */
     virtual void publishData(const DataMessage& dataMessage) {
+        PubSubMetrics& metrics = PubSubMetrics::get();
+        if (!metrics.isEnabled()) {
+            for (auto subscriber : subscriptions) {
+                subscriber->receiveData(dataMessage);
+            }
+            return;
+        }
+
+        auto startTime = FrameClock::now();
         for (auto subscriber : subscriptions) {
             subscriber->receiveData(dataMessage);
         }
+
+        metrics.recordPublish(this, getPublisherName(),
+            dataMessage.getType(), subscriptions.size(),
+            dataMessage.getSize(), FrameClock::now() - startTime);
+    }
+
+    /** @returns Name used to identify publisher in metrics */
+    virtual std::string getPublisherName() const {
+        return PubSubMetrics::getTypeName(typeid(*this));
     }
 
     /** @brief Add IDataSubscriber */
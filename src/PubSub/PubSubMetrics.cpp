@@ -0,0 +1,88 @@
+#include "PubSubMetrics.hpp"
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+
+#include <cstdlib>
+#include <memory>
+#endif
+
+namespace basil {
+
+MessageMetrics MessageMetrics::operator+(const MessageMetrics& addend) const {
+    return MessageMetrics {
+        .messageCount = messageCount + addend.messageCount,
+        .deliveryCount = deliveryCount + addend.deliveryCount,
+        .bytesDelivered = bytesDelivered + addend.bytesDelivered,
+        .receiveTime = receiveTime + addend.receiveTime
+    };
+}
+
+MessageMetrics MessageMetrics::operator-(
+        const MessageMetrics& subtrahend) const {
+    return MessageMetrics {
+        .messageCount = messageCount - subtrahend.messageCount,
+        .deliveryCount = deliveryCount - subtrahend.deliveryCount,
+        .bytesDelivered = bytesDelivered - subtrahend.bytesDelivered,
+        .receiveTime = receiveTime - subtrahend.receiveTime
+    };
+}
+
+MessageMetrics MessageMetrics::operator/(int divisor) const {
+    return MessageMetrics {
+        .messageCount = messageCount / divisor,
+        .deliveryCount = deliveryCount / divisor,
+        .bytesDelivered = bytesDelivered / divisor,
+        .receiveTime = receiveTime / divisor
+    };
+}
+
+void PubSubMetrics::recordPublish(
+        const void* publisher,
+        const std::string& publisherName,
+        const std::type_info& type,
+        unsigned int subscribers,
+        std::size_t bytes,
+        FrameClock::duration receiveTime) {
+    InternalKey key = { publisher, std::type_index(type) };
+    if (!entries.contains(key)) {
+        entries.emplace(key,
+            Entry { publisherName, std::type_index(type), {} });
+    }
+
+    MessageMetrics& metrics = entries.at(key).metrics;
+    metrics.messageCount += 1;
+    metrics.deliveryCount += subscribers;
+    metrics.bytesDelivered += bytes * subscribers;
+    metrics.receiveTime += receiveTime;
+}
+
+std::map<MessageMetricsKey, MessageMetrics> PubSubMetrics::flush() {
+    std::map<MessageMetricsKey, MessageMetrics> result;
+
+    for (const auto& [key, entry] : entries) {
+        MessageMetricsKey readableKey =
+            { entry.publisherName, getTypeName(entry.type) };
+
+        result[readableKey] = result[readableKey] + entry.metrics;
+    }
+
+    entries.clear();
+    return result;
+}
+
+std::string PubSubMetrics::getTypeName(std::type_index type) {
+#if defined(__GNUG__)
+    int status = 0;
+    std::unique_ptr<char, decltype(&std::free)> demangled(
+        abi::__cxa_demangle(type.name(), nullptr, nullptr, &status),
+        &std::free);
+
+    if (status == 0 && demangled) {
+        return std::string(demangled.get());
+    }
+#endif
+    return std::string(type.name());
+}
+
+}  // namespace basil
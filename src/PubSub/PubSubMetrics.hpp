@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+#include <Basil/Packages/Chrono.hpp>
+
+namespace basil {
+
+/** @brief Counters for messages of one type sent by one publisher. */
+struct MessageMetrics {
+    /** @brief Number of calls to publishData. */
+    unsigned int messageCount = 0;
+
+    /** @brief Number of subscribers reached, summed over messages. */
+    unsigned int deliveryCount = 0;
+
+    /** @brief Shallow size of payload, summed over deliveries.
+     *  Payloads are passed by reference, so this is the data made
+     *  visible to subscribers, rather than data copied. */
+    std::size_t bytesDelivered = 0;
+
+    /** @brief Time spent in subscribers' receiveData, including
+     *  time spent in any downstream publishers. */
+    FrameClock::duration receiveTime = FrameClock::duration::zero();
+
+    MessageMetrics operator+(const MessageMetrics& addend) const;
+    MessageMetrics operator-(const MessageMetrics& subtrahend) const;
+    MessageMetrics operator/(int divisor) const;
+
+    bool operator==(const MessageMetrics& comparison) const = default;
+};
+
+/** @brief Publisher name and message type name. */
+using MessageMetricsKey = std::pair<std::string, std::string>;
+
+/** @brief Global collector of PubSub message counters, using Singleton
+ *  pattern. Disabled by default, in which case publishing is untimed. */
+class PubSubMetrics {
+ public:
+    /** @return Instance of Singleton collector. */
+    static PubSubMetrics& get() {
+        static PubSubMetrics instance;
+        return instance;
+    }
+
+    /** @return Whether publishers should record counters. */
+    bool isEnabled() const { return enabled; }
+
+    /** @brief Enable or disable recording of counters. */
+    void setEnabled(bool enabled) { this->enabled = enabled; }
+
+    /** @brief Record a single call to publishData.
+     *  @param publisher    Address of publisher, used as key
+     *  @param publisherName Readable name of publisher
+     *  @param type         Type of message payload
+     *  @param subscribers  Number of subscribers reached
+     *  @param bytes        Shallow size of message payload
+     *  @param receiveTime  Time spent delivering message */
+    void recordPublish(
+        const void* publisher,
+        const std::string& publisherName,
+        const std::type_info& type,
+        unsigned int subscribers,
+        std::size_t bytes,
+        FrameClock::duration receiveTime);
+
+    /** @brief Collects counters recorded since the last flush.
+     *  @returns Map of counters by publisher and message type. */
+    std::map<MessageMetricsKey, MessageMetrics> flush();
+
+    /** @returns Human-readable name of type. */
+    static std::string getTypeName(std::type_index type);
+
+#ifndef TEST_BUILD
+
+ private:
+#endif
+    PubSubMetrics() = default;
+
+    using InternalKey = std::pair<const void*, std::type_index>;
+
+    struct Entry {
+        std::string publisherName;
+        std::type_index type;
+        MessageMetrics metrics;
+    };
+
+    std::map<InternalKey, Entry> entries;
+    bool enabled = false;
+};
+
+}   // namespace basil
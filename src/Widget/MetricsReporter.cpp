@@ -49,9 +49,50 @@ void MetricsReporter::onLoop() {
                     name, timeInMilliseconds),
                 logLevel);
         }
+
+        for (auto message : record.messageMetrics) {
+            auto& [publisher, type] = message.first;
+            MessageMetrics& counters = message.second;
+            auto timeInNanoseconds =
+                std::chrono::nanoseconds(counters.receiveTime);
+
+            double timeInMilliseconds = timeInNanoseconds.count() / 1'000'000.;
+
+            logger.log(
+                fmt::format(LOG_MESSAGES,
+                    publisher, type, counters.messageCount,
+                    counters.deliveryCount, counters.bytesDelivered,
+                    timeInMilliseconds),
+                logLevel);
+        }
+
+        for (auto event : record.eventMetrics) {
+            auto timeInNanoseconds =
+                std::chrono::nanoseconds(event.second.totalTime);
+
+            double timeInMilliseconds = timeInNanoseconds.count() / 1'000'000.;
+
+            logger.log(
+                fmt::format(LOG_EVENT,
+                    event.first, event.second.eventCount,
+                    timeInMilliseconds),
+                logLevel);
+        }
+
+        for (auto call : record.glCallMetrics) {
+            logger.log(
+                fmt::format(LOG_GL_CALLS,
+                    GLCallMetrics::getTypeName(call.first),
+                    call.second.callCount, call.second.bytes),
+                logLevel);
+        }
     }
 }
 
+void MetricsReporter::setMessageMetricsEnabled(bool enabled) {
+    PubSubMetrics::get().setEnabled(enabled);
+}
+
 MetricsReporter::Builder&
 MetricsReporter::Builder::withRegularity(unsigned int regularity) {
     impl->setRegularity(regularity);
@@ -64,4 +105,10 @@ MetricsReporter::Builder::withLogLevel(LogLevel level) {
     return *this;
 }
 
+MetricsReporter::Builder&
+MetricsReporter::Builder::withMessageMetrics(bool enabled) {
+    impl->setMessageMetricsEnabled(enabled);
+    return *this;
+}
+
 }  // namespace basil
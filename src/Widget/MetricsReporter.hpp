@@ -30,6 +30,9 @@ class MetricsReporter : public IBasilWidget,
         this->logLevel = level;
     }
 
+    /** @brief Enable or disable collection of PubSub message counters. */
+    void setMessageMetricsEnabled(bool enabled);
+
     /** @brief Builder pattern for MetricsReporter. */
     class Builder : public IBuilder<MetricsReporter> {
      public:
@@ -38,6 +41,9 @@ class MetricsReporter : public IBasilWidget,
 
         /** @brief Set severity level for logging*/
         Builder& withLogLevel(LogLevel level);
+
+        /** @brief Enable collection and logging of PubSub counters. */
+        Builder& withMessageMetrics(bool enabled = true);
     };
 
 #ifndef TEST_BUILD
@@ -57,6 +63,12 @@ class MetricsReporter : public IBasilWidget,
         "Max frame rate: {:.2f}";
     LOGGER_FORMAT LOG_PROCESS_TIME =
         "Process \'{}\': {:.3f}ms";
+    LOGGER_FORMAT LOG_MESSAGES =
+        "Messages \'{}\' <{}>: {} sent, {} delivered, {} bytes, {:.3f}ms";
+    LOGGER_FORMAT LOG_EVENT =
+        "Event \'{}\': {} in window, {:.3f}ms total";
+    LOGGER_FORMAT LOG_GL_CALLS =
+        "GL calls \'{}\': {} per frame, {} bytes";
 };
 
 }   // namespace basil
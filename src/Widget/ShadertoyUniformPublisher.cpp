@@ -3,7 +3,7 @@
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
-#include <vector>
+#include <array>
 
 namespace basil {
 
@@ -23,15 +23,15 @@ void ShadertoyUniformPublisher::onStart() {
 
 void ShadertoyUniformPublisher::initializeUniforms() {
     resolutionID =  uniformModel.addUniform(
-        std::vector<float>({0., 0., 0.}), RESOLUTION_UNIFORM_NAME);
+        lastResolution, RESOLUTION_UNIFORM_NAME);
     mouseID =       uniformModel.addUniform(
-        std::vector<float>({0., 0., 0., 0.}), MOUSE_UNIFORM_NAME);
+        lastMouse, MOUSE_UNIFORM_NAME);
     timeID =        uniformModel.addUniform(
         0.f, TIME_UNIFORM_NAME);
     deltaTimeID =   uniformModel.addUniform(
         0.f, DELTATIME_UNIFORM_NAME);
     frameRateID =   uniformModel.addUniform(
-        0, FRAMERATE_UNIFORM_NAME);
+        0.f, FRAMERATE_UNIFORM_NAME);
 }
 
 void ShadertoyUniformPublisher::onLoop() {
@@ -42,7 +42,19 @@ void ShadertoyUniformPublisher::onLoop() {
     setMouse();
     setTime();
 
-    this->IDataPublisher::publishData(DataMessage(uniformModel));
+    publishUniforms();
+}
+
+void ShadertoyUniformPublisher::publishUniforms() {
+    // Newly subscribed receivers have not seen earlier changes
+    if (subscriptions != publishedSubscriptions) {
+        publishedSubscriptions = subscriptions;
+        publishedVersion = 0;
+    }
+
+    this->IDataPublisher::publishData(
+        DataMessage(uniformModel.getDelta(publishedVersion)));
+    publishedVersion = uniformModel.getVersion();
 }
 
 void ShadertoyUniformPublisher::setResolution() {
@@ -57,10 +69,13 @@ void ShadertoyUniformPublisher::setResolution() {
     resolution_x = static_cast<float>(viewArea.width);
     resolution_y = static_cast<float>(viewArea.height);
 
-    std::vector<float> iResolution =
+    std::array<float, 3> iResolution =
         { resolution_x, resolution_y, PIXEL_ASPECT_RATIO };
 
-    uniformModel.setUniformValue(iResolution, resolutionID);
+    if (iResolution != lastResolution) {
+        uniformModel.setUniformValue(iResolution, resolutionID);
+        lastResolution = iResolution;
+    }
 }
 
 void ShadertoyUniformPublisher::setMouse() {
@@ -93,13 +108,17 @@ void ShadertoyUniformPublisher::setMouse() {
     wasClicking = isClicking;
 
     // iMouse.zw are signed based on current click logic
-    std::vector<float> iMouse =
+    std::array<float, 4> iMouse =
         {   lastDown_x,
             lastDown_y,
             (isClicking   ? 1 : -1) * lastStart_x,
             (isClickStart ? 1 : -1) * lastStart_y
         };
-    uniformModel.setUniformValue(iMouse, mouseID);
+
+    if (iMouse != lastMouse) {
+        uniformModel.setUniformValue(iMouse, mouseID);
+        lastMouse = iMouse;
+    }
 }
 
 void ShadertoyUniformPublisher::setTime() {
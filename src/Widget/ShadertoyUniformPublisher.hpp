@@ -1,7 +1,10 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 #include <Basil/Packages/App.hpp>
 #include <Basil/Packages/Builder.hpp>
@@ -27,7 +30,8 @@ class ShadertoyUniformPublisher : public IBasilWidget,
     /** @brief Initialize uniforms and start child widgets */
     void onStart() override;
 
-    /** @brief Update uniforms, run child widgets, and publish model */
+    /** @brief Update uniforms, run child widgets, and publish
+     *  uniforms changed since the previous loop */
     void onLoop() override;
 
     /** @returns Reference to ShaderUniformModel */
@@ -58,6 +62,8 @@ class ShadertoyUniformPublisher : public IBasilWidget,
     void setMouse();
     void setTime();
 
+    void publishUniforms();
+
     std::shared_ptr<IPane> focusPane = nullptr;
 
     UserInputWatcher inputWatcher = UserInputWatcher();
@@ -71,8 +77,16 @@ class ShadertoyUniformPublisher : public IBasilWidget,
     float   lastDown_x = 0, lastDown_y = 0, lastStart_x = 0,
             lastStart_y = 0, resolution_x = 0, resolution_y = 0;
 
-    unsigned int resolutionID = 0, mouseID = 0, timeID = 0,
-                 deltaTimeID = 0, frameRateID = 0;
+    ShaderUniformHandle<GLUniformInline<float, 3>> resolutionID;
+    ShaderUniformHandle<GLUniformInline<float, 4>> mouseID;
+    ShaderUniformHandle<GLUniformScalar<float>> timeID, deltaTimeID,
+                                                frameRateID;
+
+    std::array<float, 3> lastResolution = {};
+    std::array<float, 4> lastMouse = {};
+
+    uint64_t publishedVersion = 0;
+    std::set<std::shared_ptr<IDataSubscriber>> publishedSubscriptions;
 
     bool wasClicking = false;
 
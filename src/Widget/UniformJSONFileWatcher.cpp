@@ -19,20 +19,21 @@ UniformJSONFileWatcher::UniformJSONFileWatcher(std::filesystem::path filePath)
     setFilePath(filePath);
 }
 
+void UniformJSONFileWatcher::setFilePath(std::filesystem::path setFilePath) {
+    filePath = setFilePath;
+    fileWatch = FileWatchService::get().watch(filePath);
+}
+
 void UniformJSONFileWatcher::updateModel() {
+    if (!fileWatch || !fileWatch->hasChanged()) return;
     if (!std::filesystem::exists(filePath)) return;
 
-    auto currentTime = std::filesystem::last_write_time(filePath);
-    if (currentTime > timestamp) {
-        timestamp = currentTime;
-
-        std::optional<ShaderUniformModel> model =
-            FileDataLoader::modelFromJSON(filePath);
+    std::optional<ShaderUniformModel> model =
+        FileDataLoader::modelFromJSON(filePath);
 
-        if (model.has_value()) {
-            auto message = DataMessage(model.value());
-            publishData(message);
-        }
+    if (model.has_value()) {
+        auto message = DataMessage(model.value());
+        publishData(message);
     }
 }
 
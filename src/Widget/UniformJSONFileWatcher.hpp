@@ -1,10 +1,13 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 
 #include <Basil/Packages/App.hpp>
 #include <Basil/Packages/Builder.hpp>
 
+#include "File/FileWatchService.hpp"
+
 namespace basil {
 
 /** @brief Utility class to hot reload shader uniforms from JSON file */
@@ -14,10 +17,8 @@ class UniformJSONFileWatcher : public IBasilWidget,
     /** @brief Initialize with given file path of JSON file. */
     explicit UniformJSONFileWatcher(std::filesystem::path filePath);
 
-    /** @brief Set path to JSON file. */
-    void setFilePath(std::filesystem::path setFilePath) {
-        this->filePath = setFilePath;
-    }
+    /** @brief Set path to JSON file, and start watching it. */
+    void setFilePath(std::filesystem::path setFilePath);
 
     /** @brief Reload JSON uniforms on process main loop. */
     void onLoop() override { updateModel(); }
@@ -40,8 +41,7 @@ class UniformJSONFileWatcher : public IBasilWidget,
     void updateModel();
 
     std::filesystem::path filePath;
-    std::filesystem::file_time_type timestamp
-        = std::filesystem::file_time_type::min();
+    std::shared_ptr<FileWatch> fileWatch = nullptr;
 };
 
 }   // namespace basil
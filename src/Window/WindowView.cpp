@@ -1,5 +1,8 @@
 #include "WindowView.hpp"
 
+#include "File/AsyncTextureLoader.hpp"
+#include "OpenGL/GLStateCache.hpp"
+
 namespace basil {
 
 WindowView::WindowView(std::optional<WindowProps> windowProps) : IBasilWidget({
@@ -95,10 +98,13 @@ void WindowView::onResize(int width, int height) {
 
 void WindowView::draw() {
     // Clear background color
-    glBlendFunc(GL_ONE, GL_ZERO);
+    GLStateCache::get().setBlendFunc(GL_ONE, GL_ZERO);
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
 
+    // Swap in textures which have finished loading
+    AsyncTextureLoader::get().uploadPending();
+
     // Render using double buffer
     if (topPane) {
         topPane->draw();
@@ -1,5 +1,7 @@
 #include <catch.hpp>
 
+#include <fmt/format.h>
+
 #include "Data/ShaderUniformModel.hpp"
 
 #include "OpenGL/GLUniform.hpp"
@@ -69,6 +71,23 @@ TEST_CASE("Data_ShaderUniformModel_addUniform") {
             == 4);
     }
 
+    SECTION("Packs fixed-size values into model storage") {
+        auto vec3ID = dataModel.addUniform(
+            std::array<float, 3>({ 1.f, 2.f, 3.f }), "myVec3");
+
+        CHECK(dataModel.slots[floatID].isPacked());
+        CHECK(dataModel.slots[vec3ID].isPacked());
+        CHECK(dataModel.slots[vec3ID].length == 3);
+        CHECK_FALSE(dataModel.slots[intID].isPacked());
+        CHECK_FALSE(dataModel.slots[uintID].isPacked());
+        CHECK(dataModel.uniformData.size() == 4 * sizeof(float));
+
+        auto vec3 = dataModel.getUniform(vec3ID).value();
+        CHECK(vec3->getLength() == 3);
+        CHECK(vec3->getDataSize() == 3 * sizeof(float));
+        CHECK(reinterpret_cast<float*>(vec3->getData())[1] == 2.f);
+    }
+
     SECTION("Saves uniform containing texture location") { BASIL_LOCK_TEST
         auto texture = std::make_shared<GLTexture2D>();
 
@@ -97,6 +116,28 @@ TEST_CASE("Data_ShaderUniformModel_getUniform") {
             == 1.5f);
         CHECK_FALSE(dataModel.getUniform(-1).has_value());
     }
+
+    SECTION("Assigns IDs per model, in order of addition") {
+        auto otherModel = ShaderUniformModel();
+        CHECK(otherModel.addUniform(1, "myInt") == 0);
+        CHECK(dataModel.addUniform(1, "myInt") == floatID + 1);
+    }
+
+    SECTION("Finds uniforms by name after growing name table") {
+        for (int i = 0; i < 100; i++) {
+            dataModel.addUniform(i, fmt::format("myInt{}", i));
+        }
+
+        CHECK(dataModel.getUniforms().size() == 101);
+        CHECK(dataModel.nameTable.size() >= 2 * 101);
+        for (int i = 0; i < 100; i++) {
+            auto uniform = dataModel.getUniform(fmt::format("myInt{}", i));
+            REQUIRE(uniform.has_value());
+            CHECK(*reinterpret_cast<int*>(uniform.value()->getData()) == i);
+        }
+        CHECK(dataModel.getUniform("myFloat").has_value());
+        CHECK_FALSE(dataModel.getUniform("myInt100").has_value());
+    }
 }
 
 TEST_CASE("Data_ShaderUniformModel_setUniformValue") {
@@ -154,6 +195,154 @@ TEST_CASE("Data_ShaderUniformModel_setUniformValue") {
     }
 }
 
+TEST_CASE("Data_ShaderUniformModel_ShaderUniformHandle") {
+    auto dataModel = ShaderUniformModel();
+    auto floatHandle = dataModel.addUniform(1.5f, "myFloat");
+    auto arrayHandle = dataModel.addUniform(
+        std::array<float, 3>({ 1.f, 2.f, 3.f }), "myVec3");
+    auto vectorHandle = dataModel.addUniform(
+        std::vector<int>({ 1, 2 }), "myInts");
+
+    SECTION("Converts to uniform ID") {
+        unsigned int floatID = floatHandle;
+        CHECK(dataModel.getUniform(floatID).value()->getName() == "myFloat");
+    }
+
+    SECTION("Overwrites uniforms in place") {
+        auto vectorUniform = dataModel.getUniform(vectorHandle).value();
+        std::size_t packedSize = dataModel.uniformData.size();
+        std::size_t arrayOffset = dataModel.slots[arrayHandle].offset;
+
+        CHECK(dataModel.setUniformValue(2.5f, floatHandle));
+        CHECK(dataModel.setUniformValue(
+            std::array<float, 3>({ 4.f, 5.f, 6.f }), arrayHandle));
+        CHECK(dataModel.setUniformValue(
+            std::vector<int>({ 3, 4 }), vectorHandle));
+
+        CHECK(dataModel.uniformData.size() == packedSize);
+        CHECK(dataModel.slots[arrayHandle].offset == arrayOffset);
+        CHECK(dataModel.getUniform(vectorHandle).value() == vectorUniform);
+
+        auto floatUniform = dataModel.getUniform(floatHandle).value();
+        auto arrayUniform = dataModel.getUniform(arrayHandle).value();
+        CHECK(*reinterpret_cast<float*>(floatUniform->getData()) == 2.5f);
+        CHECK(reinterpret_cast<float*>(arrayUniform->getData())[2] == 6.f);
+        CHECK(reinterpret_cast<int*>(vectorUniform->getData())[1] == 4);
+    }
+
+    SECTION("Replaces views of packed values once changed") {
+        auto floatUniform = dataModel.getUniform(floatHandle).value();
+        CHECK(dataModel.getUniform(floatHandle).value() == floatUniform);
+
+        dataModel.setUniformValue(2.5f, floatHandle);
+        CHECK(dataModel.getUniform(floatHandle).value() != floatUniform);
+        CHECK(*reinterpret_cast<float*>(floatUniform->getData()) == 1.5f);
+    }
+
+    SECTION("Overwrites leading values of inline arrays") {
+        std::vector<float> leading = { 7.f };
+        CHECK(dataModel.setUniformValue(
+            std::span<const float>(leading), arrayHandle));
+
+        auto arrayUniform = dataModel.getUniform(arrayHandle).value();
+        CHECK(reinterpret_cast<float*>(arrayUniform->getData())[0] == 7.f);
+        CHECK(reinterpret_cast<float*>(arrayUniform->getData())[1] == 2.f);
+    }
+
+    SECTION("Keeps packed values of copies apart") {
+        ShaderUniformModel copy = dataModel;
+        dataModel.setUniformValue(2.5f, floatHandle);
+
+        CHECK(*reinterpret_cast<float*>(
+            copy.getUniform(floatHandle).value()->getData()) == 1.5f);
+    }
+
+    SECTION("Marks uniform as changed") {
+        uint64_t version = dataModel.getVersion();
+        dataModel.setUniformValue(2.5f, floatHandle);
+
+        CHECK(dataModel.getUniformVersion(floatHandle) == version + 1);
+    }
+
+    SECTION("Fails if uniform was replaced with different type") {
+        dataModel.setUniformValue(std::vector<float>({ 1.f }), floatHandle);
+        CHECK_FALSE(dataModel.setUniformValue(3.5f, floatHandle));
+
+        CHECK_FALSE(dataModel.setUniformValue(
+            1.f, basil::ShaderUniformHandle<GLUniformScalar<float>>()));
+    }
+}
+
+TEST_CASE("Data_ShaderUniformModel_getDelta") {
+    auto dataModel = ShaderUniformModel();
+    unsigned int floatID = dataModel.addUniform(1.5f, "myFloat");
+    unsigned int intID = dataModel.addUniform(3, "myInt");
+
+    SECTION("Increments version on each change") {
+        uint64_t version = dataModel.getVersion();
+        CHECK(version == 2);
+        CHECK(dataModel.getUniformVersion(floatID) == 1);
+        CHECK(dataModel.getUniformVersion(intID) == 2);
+
+        dataModel.setUniformValue(2.5f, floatID);
+        CHECK(dataModel.getVersion() == version + 1);
+        CHECK(dataModel.getUniformVersion(floatID) == version + 1);
+        CHECK_FALSE(dataModel.getUniformVersion(-1).has_value());
+    }
+
+    SECTION("Contains all uniforms from version zero") {
+        auto delta = dataModel.getDelta();
+
+        CHECK(delta.isComplete());
+        CHECK(delta.modelID == dataModel.getModelID());
+        CHECK(delta.version == dataModel.getVersion());
+        CHECK(delta.uniforms.size() == 2);
+    }
+
+    SECTION("Contains only uniforms changed since version") {
+        uint64_t version = dataModel.getVersion();
+        dataModel.setUniformValue(7, intID);
+
+        auto delta = dataModel.getDelta(version);
+        CHECK_FALSE(delta.isComplete());
+        CHECK(delta.baseVersion == version);
+        REQUIRE(delta.uniforms.size() == 1);
+        CHECK(delta.uniforms.front()->getName() == "myInt");
+
+        CHECK(dataModel.getDelta(dataModel.getVersion()).uniforms.empty());
+    }
+
+    SECTION("Always contains pointer uniforms") {
+        float value = 1.f;
+        dataModel.addUniform(&value, "myPointer");
+
+        auto delta = dataModel.getDelta(dataModel.getVersion());
+        REQUIRE(delta.uniforms.size() == 1);
+        CHECK(delta.uniforms.front()->getName() == "myPointer");
+    }
+
+    SECTION("Contains storage buffers updated since version") {
+        unsigned int storageID = dataModel.addStorageBuffer(
+            std::vector<float>(4, 0.f), "MyStorage");
+        uint64_t version = dataModel.getVersion();
+
+        std::vector<float> update = { 1.f, 2.f };
+        CHECK(dataModel.updateStorageBuffer(update, storageID, 2));
+        CHECK_FALSE(dataModel.updateStorageBuffer(update, storageID, 3));
+        CHECK_FALSE(dataModel.updateStorageBuffer(update, floatID));
+
+        auto delta = dataModel.getDelta(version);
+        REQUIRE(delta.uniforms.size() == 1);
+        CHECK(delta.uniforms.front()->getName() == "MyStorage");
+    }
+
+    SECTION("Copies share model ID") {
+        ShaderUniformModel copy = dataModel;
+        CHECK(copy.getModelID() == dataModel.getModelID());
+        CHECK(ShaderUniformModel().getModelID() != dataModel.getModelID());
+    }
+}
+
 TEST_CASE("Data_ShaderUniformModel_Builder") {
     SECTION("Builds model correctly") {
         int myInt = -15;
@@ -0,0 +1,134 @@
+#include <catch.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "File/AsyncTextureLoader.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::AsyncTextureLoader;
+using basil::GLTexture2D;
+using basil::Logger;
+using basil::LogLevel;
+
+// Waits until queued files are decoded, or for timeout to expire
+static bool waitForDecode(AsyncTextureLoader& loader) {
+    auto timeout = std::chrono::steady_clock::now()
+        + std::chrono::seconds(5);
+
+    while (std::chrono::steady_clock::now() < timeout) {
+        {
+            std::lock_guard lock(loader.mutex);
+            if (loader.requests.empty() && loader.decodingCount == 0) {
+                return true;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+TEST_CASE("File_AsyncTextureLoader_load") { BASIL_LOCK_TEST
+    auto& loader = AsyncTextureLoader::get();
+    auto testImagePath =
+        std::filesystem::path(TEST_DIR) / "File/assets/test-img.jpg";
+
+    SECTION("Returns texture holding placeholder") {
+        auto texture = loader.load(testImagePath);
+
+        CHECK(texture->getID() > 0);
+        CHECK(texture->source == loader.placeholder);
+        CHECK(loader.threads.size() == BASIL_TEXTURE_DECODE_THREAD_COUNT);
+
+        REQUIRE(waitForDecode(loader));
+        loader.uploadPending();
+    }
+
+    SECTION("Uploads decoded image to texture") {
+        auto texture = loader.load(testImagePath);
+        REQUIRE(waitForDecode(loader));
+        loader.uploadPending();
+
+        CHECK(loader.getPendingCount() == 0);
+        CHECK(texture->source != loader.placeholder);
+        CHECK(texture->source->getWidth() == 256);
+        CHECK(texture->storageSize[0] == 256);
+    }
+
+    SECTION("Keeps placeholder if file can not be decoded") {
+        auto texture = loader.load("fdjsklafjdklas.jpg");
+        REQUIRE(waitForDecode(loader));
+
+        Logger& logger = Logger::get();
+        logger.clearTestInfo();
+        loader.uploadPending();
+
+        CHECK(logger.getLastLevel() == LogLevel::ERROR);
+        CHECK(texture->source == loader.placeholder);
+    }
+
+    SECTION("Skips decoding textures deleted while queued") {
+        auto texture = loader.load(testImagePath);
+        REQUIRE(waitForDecode(loader));
+        loader.uploadPending();
+
+        // Queued directly, as a texture deleted after load() may
+        // already be decoding
+        {
+            std::lock_guard lock(loader.mutex);
+            loader.requests.push_back(AsyncTextureLoader::LoadRequest {
+                testImagePath, std::weak_ptr<GLTexture2D>() });
+        }
+        loader.requestAdded.notify_one();
+        REQUIRE(waitForDecode(loader));
+
+        {
+            std::lock_guard lock(loader.mutex);
+            REQUIRE(loader.decodedImages.size() == 1);
+            CHECK(loader.decodedImages.front().source == nullptr);
+        }
+        loader.uploadPending();
+        CHECK(loader.getPendingCount() == 0);
+    }
+
+    SECTION("Skips uploading textures deleted while decoding") {
+        loader.load(testImagePath);
+        REQUIRE(waitForDecode(loader));
+
+        Logger& logger = Logger::get();
+        logger.clearTestInfo();
+        loader.uploadPending();
+
+        CHECK(loader.getPendingCount() == 0);
+        CHECK(logger.getLastLevel() != LogLevel::ERROR);
+    }
+}
+
+TEST_CASE("File_AsyncTextureLoader_uploadPending") { BASIL_LOCK_TEST
+    auto& loader = AsyncTextureLoader::get();
+    auto testImagePath =
+        std::filesystem::path(TEST_DIR) / "File/assets/test-img.jpg";
+
+    // Upload files queued by earlier tests
+    REQUIRE(waitForDecode(loader));
+    loader.uploadPending();
+    loader.uploadBudget = 1;
+
+    SECTION("Uploads one image per frame when over budget") {
+        auto first = loader.load(testImagePath);
+        auto second = loader.load(testImagePath);
+        REQUIRE(waitForDecode(loader));
+
+        loader.uploadPending();
+        CHECK(loader.getPendingCount() == 1);
+
+        loader.uploadPending();
+        CHECK(loader.getPendingCount() == 0);
+        CHECK(first->source != loader.placeholder);
+        CHECK(second->source != loader.placeholder);
+    }
+
+    loader.uploadBudget = BASIL_TEXTURE_UPLOAD_BUDGET_BYTES;
+}
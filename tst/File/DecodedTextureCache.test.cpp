@@ -0,0 +1,125 @@
+#include <catch.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+#include "File/DecodedTextureCache.hpp"
+#include "File/FileTextureSource.hpp"
+
+#include "FileTestUtils.hpp"
+
+using basil::DecodedTextureCache;
+using basil::FileTextureSource;
+
+TEST_CASE("File_DecodedTextureCache_load") {
+    auto& cache = DecodedTextureCache::get();
+    auto previousDirectory = cache.getDirectory();
+
+    auto directory = std::filesystem::path(TEST_DIR)
+        / "../build/test-tmp/DecodedTextureCache/";
+    std::filesystem::remove_all(directory);
+    cache.setDirectory(directory);
+
+    auto imagePath = FileTestUtils::setUpTempDir("cached-img.jpg");
+    std::filesystem::copy_file(
+        std::filesystem::path(TEST_DIR) / "File/assets/test-img.jpg",
+        imagePath);
+
+    SECTION("Decodes image without directory") {
+        cache.setDirectory("");
+        auto misses = cache.getMissCount();
+        auto source = cache.load(imagePath);
+
+        CHECK(std::dynamic_pointer_cast<FileTextureSource>(source));
+        CHECK(cache.getMissCount() == misses);
+        CHECK_FALSE(std::filesystem::exists(directory));
+    }
+
+    SECTION("Decodes and saves image not found in cache") {
+        auto misses = cache.getMissCount();
+        auto source = cache.load(imagePath);
+
+        CHECK(source->getWidth() == 256);
+        CHECK(cache.getMissCount() == misses + 1);
+        CHECK_FALSE(std::filesystem::is_empty(directory));
+    }
+
+    SECTION("Loads equal pixels from cache") {
+        auto decoded = cache.load(imagePath);
+        auto hits = cache.getHitCount();
+        auto cached = cache.load(imagePath);
+
+        REQUIRE(cached->data());
+        CHECK_FALSE(std::dynamic_pointer_cast<FileTextureSource>(cached));
+        CHECK(cache.getHitCount() == hits + 1);
+        CHECK(cached->getWidth() == 256);
+        CHECK(cached->getHeight() == 256);
+        CHECK(cached->format.internalFormat == GL_RGBA8);
+        CHECK(std::memcmp(decoded->data(), cached->data(),
+            256 * 256 * 4) == 0);
+    }
+
+    SECTION("Keys images by vertical flip") {
+        cache.load(imagePath);
+        auto misses = cache.getMissCount();
+        cache.load(imagePath, false);
+
+        CHECK(cache.getMissCount() == misses + 1);
+    }
+
+    SECTION("Loads from cache if source is touched without changes") {
+        cache.load(imagePath);
+        std::filesystem::last_write_time(imagePath,
+            std::filesystem::last_write_time(imagePath)
+                + std::chrono::hours(1));
+
+        auto hits = cache.getHitCount();
+        cache.load(imagePath);
+        CHECK(cache.getHitCount() == hits + 1);
+    }
+
+    SECTION("Stores new time of source touched without changes") {
+        cache.load(imagePath);
+        auto sourceTime = std::filesystem::last_write_time(imagePath)
+            + std::chrono::hours(1);
+        std::filesystem::last_write_time(imagePath, sourceTime);
+        cache.load(imagePath);
+
+        DecodedTextureCache::FileHeader header;
+        std::ifstream file(cache.getFilePath(imagePath, true),
+            std::ios::binary);
+        REQUIRE(file.read(reinterpret_cast<char*>(&header),
+            sizeof(header)));
+        CHECK(header.sourceTime == sourceTime.time_since_epoch().count());
+    }
+
+    SECTION("Decodes again if source has changed") {
+        cache.load(imagePath);
+        {
+            std::ofstream file(imagePath, std::ios::binary | std::ios::app);
+            file << '\0';
+        }
+
+        auto misses = cache.getMissCount();
+        cache.load(imagePath);
+        CHECK(cache.getMissCount() == misses + 1);
+    }
+
+    SECTION("Decodes again if cache file is invalid") {
+        cache.load(imagePath);
+        for (const auto& entry :
+                std::filesystem::directory_iterator(directory)) {
+            std::ofstream file(entry.path(),
+                std::ios::binary | std::ios::trunc);
+            file << "invalid";
+        }
+
+        auto misses = cache.getMissCount();
+        auto source = cache.load(imagePath);
+        CHECK(cache.getMissCount() == misses + 1);
+        CHECK(source->getWidth() == 256);
+    }
+
+    cache.setDirectory(previousDirectory);
+}
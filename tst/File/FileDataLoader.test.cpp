@@ -1,8 +1,11 @@
 #include <catch.hpp>
 
+#include <cstring>
+
 #include "File/FileDataLoader.hpp"
 using basil::FileDataLoader;
 using basil::GLUniform;
+using basil::GLUniformStorage;
 using basil::Logger;
 using basil::LogLevel;
 
@@ -94,6 +97,24 @@ TEST_CASE("File_FileDataLoader_modelFromJSON") {
                 reinterpret_cast<int*>(testArray->getData())[i]);
         }
 
+        REQUIRE(model.getUniform("TestStorage1").has_value());
+        auto testStorage = std::dynamic_pointer_cast<GLUniformStorage>(
+            model.getUniform("TestStorage1").value());
+        REQUIRE(testStorage);
+        REQUIRE(testStorage->getStorageSize() == 4 * sizeof(float));
+
+        std::vector<float> expectedStorage = { 0.5f, 1.5f, 2.5f, 3.5f };
+        CHECK(std::memcmp(testStorage->getStorageData(),
+            expectedStorage.data(), testStorage->getStorageSize()) == 0);
+
+        REQUIRE(model.getUniform("TestStorage2").has_value());
+        testStorage = std::dynamic_pointer_cast<GLUniformStorage>(
+            model.getUniform("TestStorage2").value());
+        REQUIRE(testStorage);
+        REQUIRE(testStorage->getStorageSize() == sizeof(unsigned int));
+        CHECK(*reinterpret_cast<const unsigned int*>(
+            testStorage->getStorageData()) == 1);
+
         CHECK(model.getUniform("testTexture").has_value());
 
         CHECK(model.getUniform("testCubemap").has_value());
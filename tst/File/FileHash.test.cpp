@@ -0,0 +1,23 @@
+#include <catch.hpp>
+
+#include "File/FileHash.hpp"
+
+using basil::FileHash;
+
+TEST_CASE("File_FileHash_hash") {
+    SECTION("Matches FNV-1a reference values") {
+        CHECK(FileHash::hash("") == 0xcbf29ce484222325);
+        CHECK(FileHash::hash("a") == 0xaf63dc4c8601ec8c);
+        CHECK(FileHash::hash("foobar") == 0x85944171f73967e8);
+    }
+
+    SECTION("Hashes data in several parts") {
+        CHECK(FileHash::hash("bar", FileHash::hash("foo"))
+            == FileHash::hash("foobar"));
+    }
+
+    SECTION("Includes null characters") {
+        using std::string_view_literals::operator""sv;
+        CHECK(FileHash::hash("a\0b"sv) != FileHash::hash("ab"));
+    }
+}
@@ -0,0 +1,150 @@
+#include <chrono>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+
+#include "File/FileWatchService.hpp"
+
+#include "File/FileTestUtils.hpp"
+
+using basil::FileWatch;
+using basil::FileWatchService;
+
+static void writeFile(const std::filesystem::path& path,
+        const std::string& contents) {
+    std::ofstream file(path);
+    file << contents;
+}
+
+// Waits for change to be reported, or for timeout to expire
+static bool waitForChange(FileWatch& fileWatch,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+    auto endTime = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < endTime) {
+        if (fileWatch.hasChanged()) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+// Waits for service to have no unreported change of file at path,
+// or for timeout to expire
+static bool waitForSettled(FileWatchService& service,
+        const std::filesystem::path& path,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+    auto absolutePath = std::filesystem::absolute(path).lexically_normal();
+    auto endTime = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < endTime) {
+        {
+            std::lock_guard lock(service.mutex);
+            auto found = service.files.find(absolutePath);
+            if (found != service.files.end()
+                    && !found->second.lastChange.has_value()) {
+                return true;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+TEST_CASE("File_FileWatchService_watch") {
+    FileWatchService& service = FileWatchService::get();
+    auto path = FileTestUtils::setUpTempDir("watched.txt");
+    writeFile(path, "initial");
+
+    auto fileWatch = service.watch(path);
+
+    SECTION("Reports change on first check only") {
+        CHECK(fileWatch->getPath() == path);
+        CHECK(fileWatch->hasChanged());
+        CHECK_FALSE(fileWatch->hasChanged());
+    }
+
+    SECTION("Reports modification of file") {
+        fileWatch->hasChanged();
+
+        writeFile(path, "modified");
+        CHECK(waitForChange(*fileWatch));
+    }
+
+    SECTION("Reports burst of modifications once") {
+        fileWatch->hasChanged();
+
+        for (int i = 0; i < 5; i++) {
+            writeFile(path, std::to_string(i));
+        }
+        CHECK(waitForChange(*fileWatch));
+        REQUIRE(waitForSettled(service, path));
+        CHECK_FALSE(fileWatch->hasChanged());
+    }
+
+    SECTION("Reports file replaced by rename") {
+        fileWatch->hasChanged();
+
+        auto replacement = FileTestUtils::setUpTempDir("replacement.txt");
+        writeFile(replacement, "replaced");
+        std::filesystem::rename(replacement, path);
+        CHECK(waitForChange(*fileWatch));
+    }
+
+    SECTION("Reports creation of missing file") {
+        auto missingPath = FileTestUtils::setUpTempDir("created.txt");
+        auto missingWatch = service.watch(missingPath);
+        missingWatch->hasChanged();
+
+        writeFile(missingPath, "created");
+        CHECK(waitForChange(*missingWatch));
+    }
+
+    SECTION("Shares watched file between handles") {
+        auto otherWatch = service.watch(path);
+        fileWatch->hasChanged();
+        otherWatch->hasChanged();
+
+        writeFile(path, "modified");
+        CHECK(waitForChange(*fileWatch));
+        CHECK(waitForChange(*otherWatch));
+    }
+
+    SECTION("Starts one thread for concurrent watches") {
+        std::vector<std::shared_ptr<FileWatch>> watches(8);
+        std::vector<std::thread> threads;
+        for (auto& watch : watches) {
+            threads.emplace_back([&service, &watch, &path]() {
+                watch = service.watch(path);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (const auto& watch : watches) {
+            REQUIRE_FALSE(watch == nullptr);
+            watch->hasChanged();
+        }
+        writeFile(path, "modified");
+        for (const auto& watch : watches) {
+            CHECK(waitForChange(*watch));
+        }
+    }
+
+    SECTION("Stops watching once handle is destroyed") {
+        fileWatch = nullptr;
+
+        std::lock_guard lock(service.mutex);
+        auto absolutePath =
+            std::filesystem::absolute(path).lexically_normal();
+        CHECK_FALSE(service.files.contains(absolutePath));
+    }
+}
+
+#ifdef __linux__
+TEST_CASE("File_FileWatchService_isUsingInotify") {
+    SECTION("Uses inotify on Linux") {
+        CHECK(FileWatchService::get().isUsingInotify());
+    }
+}
+#endif
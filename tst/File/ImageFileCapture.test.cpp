@@ -1,11 +1,13 @@
 #include <catch.hpp>
 
 #include "File/ImageFileCapture.hpp"
+#include "OpenGL/GLStateCache.hpp"
 
 #include "File/FileTestUtils.hpp"
 #include "OpenGL/GLTestUtils.hpp"
 
 using basil::BasilContext;
+using basil::GLStateCache;
 using basil::ViewArea;
 using basil::ImageFileCapture;
 
@@ -24,6 +26,13 @@ TEST_CASE("File_ImageFileCapture_copyFrameToBuffer") { BASIL_LOCK_TEST
         auto result = capture.copyFrameToBuffer({1, 1, 0, 0});
         CHECK(result != nullptr);
     }
+
+    SECTION("Unbinds pack buffer once cleared") {
+        capture.copyFrameToBuffer({1, 1, 0, 0});
+        capture.clearBuffer();
+
+        CHECK(GLStateCache::get().packBuffer == 0u);
+    }
 }
 
 TEST_CASE("File_ImageFileCapture_saveBufferToFile") {
@@ -0,0 +1,40 @@
+#include <catch.hpp>
+
+#include <cstring>
+#include <fstream>
+
+#include "File/MappedFile.hpp"
+
+#include "FileTestUtils.hpp"
+
+using basil::MappedFile;
+
+TEST_CASE("File_MappedFile_MappedFile") {
+    auto path = FileTestUtils::setUpTempDir("mapped.bin");
+
+    SECTION("Maps contents of file") {
+        {
+            std::ofstream file(path, std::ios::binary);
+            file << "mapped contents";
+        }
+        auto mappedFile = MappedFile(path);
+
+        REQUIRE(mappedFile.isOpen());
+        CHECK(mappedFile.getSize() == 15);
+        CHECK(std::memcmp(mappedFile.getData(), "mapped contents", 15) == 0);
+    }
+
+    SECTION("Fails for missing file") {
+        auto mappedFile = MappedFile(path);
+
+        CHECK_FALSE(mappedFile.isOpen());
+        CHECK(mappedFile.getSize() == 0);
+    }
+
+    SECTION("Fails for empty file") {
+        std::ofstream(path, std::ios::binary).close();
+        auto mappedFile = MappedFile(path);
+
+        CHECK_FALSE(mappedFile.isOpen());
+    }
+}
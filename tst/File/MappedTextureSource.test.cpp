@@ -0,0 +1,150 @@
+#include <catch.hpp>
+
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "File/MappedTextureSource.hpp"
+#include "OpenGL/GLTexture.hpp"
+#include "OpenGL/SpanTextureSource.hpp"
+
+#include "FileTestUtils.hpp"
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::BasilContextLock;
+using basil::GLTexture3D;
+using basil::MappedTextureHeader;
+using basil::MappedTextureSource1D;
+using basil::MappedTextureSource2D;
+using basil::MappedTextureSource3D;
+using basil::SpanTextureSource;
+
+TEST_CASE("File_MappedTextureSource_MappedTextureSource") {
+    auto path = FileTestUtils::setUpTempDir("mapped.raw");
+
+    SECTION("Maps 3D float data written by save") {
+        std::vector<float> data = { 1, 2, 3, 4, 5, 6, 7, 8,
+                                    9, 10, 11, 12, 13, 14, 15, 16 };
+        SpanTextureSource<float, 3, 2> source(data);
+        source.setWidth(2);
+        source.setHeight(2);
+        source.setDepth(2);
+        REQUIRE(MappedTextureSource3D::save(path, source));
+
+        auto mapped = MappedTextureSource3D(path);
+        REQUIRE(mapped.data() != nullptr);
+        CHECK(mapped.getWidth() == 2);
+        CHECK(mapped.getHeight() == 2);
+        CHECK(mapped.getDepth() == 2);
+        CHECK(mapped.format.type == source.format.type);
+        CHECK(mapped.format.format == source.format.format);
+        CHECK(mapped.format.internalFormat == source.format.internalFormat);
+
+        auto result = static_cast<const float*>(mapped.data());
+        for (int i = 0; i < 16; i++) {
+            CHECK(result[i] == data.at(i));
+        }
+    }
+
+    SECTION("Maps 1D byte data written by save") {
+        std::vector<unsigned char> data = { 1, 2, 3 };
+        SpanTextureSource<unsigned char, 1, 1> source(data);
+        source.setWidth(3);
+        REQUIRE(MappedTextureSource1D::save(path, source));
+
+        auto mapped = MappedTextureSource1D(path);
+        REQUIRE(mapped.data() != nullptr);
+        CHECK(mapped.getWidth() == 3);
+        CHECK(mapped.format.format == GL_RED);
+    }
+
+    SECTION("Fails for file of other dimensionality") {
+        std::vector<float> data = { 1, 2 };
+        SpanTextureSource<float, 1, 1> source(data);
+        source.setWidth(2);
+        REQUIRE(MappedTextureSource1D::save(path, source));
+
+        auto mapped = MappedTextureSource2D(path);
+        CHECK(mapped.data() == nullptr);
+    }
+
+    SECTION("Fails for truncated file") {
+        MappedTextureHeader header;
+        header.dimensionCount = 1;
+        header.size[0] = 64;
+        header.type = GL_FLOAT;
+        header.channels = 1;
+        {
+            std::ofstream file(path, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(&header),
+                sizeof(header));
+            file << "too short";
+        }
+
+        auto mapped = MappedTextureSource1D(path);
+        CHECK(mapped.data() == nullptr);
+    }
+
+    SECTION("Fails for sizes whose product overflows") {
+        // 4 bytes x 242243305 x 49477 x 384773 wraps to 2^64 + 4
+        MappedTextureHeader header;
+        header.dimensionCount = 3;
+        header.size[0] = 242243305;
+        header.size[1] = 49477;
+        header.size[2] = 384773;
+        header.type = GL_FLOAT;
+        header.channels = 1;
+        {
+            std::ofstream file(path, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(&header),
+                sizeof(header));
+            file << "too short";
+        }
+
+        auto mapped = MappedTextureSource3D(path);
+        CHECK(mapped.data() == nullptr);
+    }
+
+    SECTION("Fails for file without header") {
+        {
+            std::ofstream file(path, std::ios::binary);
+            file << "not a raw texture";
+        }
+
+        auto mapped = MappedTextureSource1D(path);
+        CHECK(mapped.data() == nullptr);
+    }
+
+    SECTION("Fails for missing file") {
+        auto mapped = MappedTextureSource1D(path);
+        CHECK(mapped.data() == nullptr);
+    }
+}
+
+TEST_CASE("File_MappedTextureSource_upload") { BASIL_LOCK_TEST
+    auto path = FileTestUtils::setUpTempDir("mapped.raw");
+
+    SECTION("Uploads 3D texture from mapped file") {
+        std::vector<float> data = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        SpanTextureSource<float, 3, 1> source(data);
+        source.setWidth(2);
+        source.setHeight(2);
+        source.setDepth(2);
+        REQUIRE(MappedTextureSource3D::save(path, source));
+
+        auto mapped = std::make_shared<MappedTextureSource3D>(path);
+        GLTexture3D texture = GLTexture3D();
+        texture.setSource(mapped);
+        texture.update();
+
+        float result[8];
+        glActiveTexture(texture.getEnum());
+        glBindTexture(GL_TEXTURE_3D, texture.getID());
+        glGetTexImage(GL_TEXTURE_3D, 0, mapped->format.format,
+            mapped->format.type, result);
+
+        for (int i = 0; i < 8; i++) {
+            CHECK(result[i] == data.at(i));
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#include <cstring>
+
+#include <catch.hpp>
+
+#include "OpenGL/GLPixelUploadRing.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::GLPixelUploadRing;
+
+TEST_CASE("OpenGL_GLPixelUploadRing_GLPixelUploadRing") { BASIL_LOCK_TEST
+    GLPixelUploadRing ring = GLPixelUploadRing(16);
+
+    SECTION("Creates and maps buffer of all regions") {
+        GLint64 size = 0;
+        glGetNamedBufferParameteri64v(ring.getID(), GL_BUFFER_SIZE, &size);
+
+        CHECK(ring.getID() > 0);
+        CHECK(ring.mappedData != nullptr);
+        CHECK(size == 16 * BASIL_TEXTURE_UPLOAD_BUFFER_COUNT);
+    }
+
+    SECTION("Aligns regions") {
+        GLPixelUploadRing unaligned = GLPixelUploadRing(17);
+
+        CHECK(unaligned.getRegionSize() == 2 * GLPixelUploadRing::ALIGNMENT);
+    }
+}
+
+TEST_CASE("OpenGL_GLPixelUploadRing_write") { BASIL_LOCK_TEST
+    GLPixelUploadRing ring = GLPixelUploadRing(16);
+    const char data[16] = "pixel data";
+
+    SECTION("Cycles through regions") {
+        std::size_t first = ring.write(data, sizeof(data));
+        ring.fence();
+        std::size_t second = ring.write(data, sizeof(data));
+        ring.fence();
+
+        CHECK(second == (first + 16) % (16 * ring.fences.size()));
+    }
+
+    SECTION("Copies data into mapped region") {
+        std::size_t offset = ring.write(data, sizeof(data));
+
+        CHECK(std::memcmp(ring.mappedData + offset, data, 16) == 0);
+    }
+
+    SECTION("Returns mapped pointer to acquired region") {
+        std::byte* region = ring.acquire();
+
+        CHECK(region == ring.mappedData + ring.getOffset());
+    }
+
+    SECTION("Reuses region once its fence has signalled") {
+        for (std::size_t i = 0; i <= ring.fences.size(); i++) {
+            ring.write(data, sizeof(data));
+            ring.fence();
+        }
+
+        CHECK(ring.fences.at(ring.currentRegion) != nullptr);
+    }
+}
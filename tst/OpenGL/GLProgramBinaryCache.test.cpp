@@ -0,0 +1,70 @@
+#include <fstream>
+
+#include <catch.hpp>
+
+#include "OpenGL/GLProgramBinaryCache.hpp"
+#include "OpenGL/GLShaderProgram.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::GLFragmentShader;
+using basil::GLProgramBinaryCache;
+using basil::GLShaderProgram;
+using basil::GLVertexShader;
+
+TEST_CASE("OpenGL_GLProgramBinaryCache_load") { BASIL_LOCK_TEST
+    auto& cache = GLProgramBinaryCache::get();
+    auto previousDirectory = cache.getDirectory();
+
+    auto directory = std::filesystem::path(TEST_DIR)
+        / "../build/test-tmp/GLProgramBinaryCache/";
+    std::filesystem::remove_all(directory);
+    cache.setDirectory(directory);
+
+    auto vertexShader = std::make_shared<GLVertexShader>(vertexPath);
+    auto fragmentShader = std::make_shared<GLFragmentShader>(fragmentPath);
+
+    if (cache.isEnabled()) {
+        SECTION("Saves binary of program linked from source") {
+            auto misses = cache.getMissCount();
+            auto program = GLShaderProgram(vertexShader, fragmentShader);
+
+            CHECK(program.hasLinkedSuccessfully());
+            CHECK_FALSE(program.isLoadedFromBinary);
+            CHECK(cache.getMissCount() == misses + 1);
+            CHECK_FALSE(std::filesystem::is_empty(directory));
+        }
+
+        SECTION("Loads program with equal sources from binary") {
+            auto first = GLShaderProgram(vertexShader, fragmentShader);
+
+            auto hits = cache.getHitCount();
+            auto second = GLShaderProgram(vertexShader, fragmentShader);
+
+            CHECK(second.isLoadedFromBinary);
+            CHECK(second.hasLinkedSuccessfully());
+            CHECK(cache.getHitCount() == hits + 1);
+        }
+
+        SECTION("Relinks from source if binary is invalid") {
+            auto first = GLShaderProgram(vertexShader, fragmentShader);
+            for (const auto& entry :
+                    std::filesystem::directory_iterator(directory)) {
+                std::ofstream file(entry.path(),
+                    std::ios::binary | std::ios::trunc);
+                file << "invalid";
+            }
+
+            auto second = GLShaderProgram(vertexShader, fragmentShader);
+            CHECK_FALSE(second.isLoadedFromBinary);
+            CHECK(second.hasLinkedSuccessfully());
+        }
+    }
+
+    SECTION("Is disabled without directory") {
+        cache.setDirectory("");
+        CHECK_FALSE(cache.isEnabled());
+    }
+
+    cache.setDirectory(previousDirectory);
+}
@@ -5,6 +5,7 @@
 #include "OpenGL/GLProgramUniformManager.hpp"
 
 #include "OpenGL/GLShaderProgram.hpp"
+#include "OpenGL/GLTextureUnitAllocator.hpp"
 
 #include "OpenGL/GLTestUtils.hpp"
 
@@ -12,9 +13,13 @@ using basil::GLFragmentShader;
 using basil::GLProgramUniformManager;
 using basil::GLShaderProgram;
 using basil::GLTexture2D;
+using basil::GLTextureUnitAllocator;
 using basil::GLUniform;
 using basil::GLUniformScalar;
+using basil::GLUniformTexture;
 using basil::GLUniformVector;
+using basil::Logger;
+using basil::LogLevel;
 
 template<class T>
 struct UniformTestData {
@@ -136,6 +141,77 @@ TEST_CASE("OpenGL_GLProgramUniformManager_setUniform") { BASIL_LOCK_TEST
     }
 }
 
+TEST_CASE("OpenGL_GLProgramUniformManager_bindUniform") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(fragmentPath)
+        .withDefaultVertexShader()
+        .build();
+    auto& manager = program->uniformManager;
+    Logger& logger = Logger::get();
+
+    SECTION("Resolves setter once per uniform shape") {
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<float>>(1.f, "myFloat1"));
+        REQUIRE(manager.uniformBindings.contains("myFloat1"));
+        auto setter = manager.uniformBindings.at("myFloat1").setter;
+        CHECK(setter != nullptr);
+
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<float>>(2.f, "myFloat1"));
+        CHECK(manager.uniformBindings.at("myFloat1").setter == setter);
+        CHECK(manager.getUploadStats().uploads == 2);
+    }
+
+    SECTION("Accepts any source type for booleans and int for samplers") {
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<float>>(1.f, "myBool1"));
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<int>>(2, "testTex"));
+
+        CHECK(manager.uniformBindings.contains("myBool1"));
+        CHECK(manager.uniformBindings.contains("testTex"));
+    }
+
+    SECTION("Reports shape mismatches once, without uploading") {
+        logger.clearTestInfo();
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<int>>(1, "myFloat1"));
+        CHECK(logger.getLastLevel() == LogLevel::WARN);
+        CHECK_FALSE(manager.uniformBindings.contains("myFloat1"));
+
+        logger.clearTestInfo();
+        manager.setUniform(std::make_shared<GLUniformVector<float>>(
+            std::vector<float>({ 1.f, 2.f, 3.f }), "myFloat1"));
+        CHECK(logger.getLastLevel() != LogLevel::WARN);
+
+        manager.setUniform(std::make_shared<GLUniformVector<float>>(
+            std::vector<float>({ 1.f, 2.f, 3.f }), "myFloat4"));
+        CHECK(logger.getLastLevel() == LogLevel::WARN);
+
+        CHECK(manager.getUploadStats().uploads == 0);
+    }
+
+    SECTION("Names double sources set on float declarations") {
+        logger.clearTestInfo();
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<double>>(1., "myFloat1"));
+        CHECK(logger.getLastLevel() == LogLevel::WARN);
+        CHECK(logger.getLastOutput().find("double") != std::string::npos);
+        CHECK_FALSE(manager.uniformBindings.contains("myFloat1"));
+        CHECK(manager.getUploadStats().uploads == 0);
+    }
+
+    SECTION("Rebinds after shape changes") {
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<int>>(1, "myFloat1"));
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<float>>(1.f, "myFloat1"));
+
+        CHECK(manager.uniformBindings.contains("myFloat1"));
+        CHECK(manager.getUploadStats().uploads == 1);
+    }
+}
+
 TEST_CASE("OpenGL_GLProgramUniformManager_getUniformLocation") { BASIL_LOCK_TEST
     auto program = GLShaderProgram::Builder()
         .withFragmentShaderFromFile(fragmentPath)
@@ -149,6 +225,180 @@ TEST_CASE("OpenGL_GLProgramUniformManager_getUniformLocation") { BASIL_LOCK_TEST
     }
 }
 
+TEST_CASE("OpenGL_GLProgramUniformManager_loadUniformTable") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(fragmentPath)
+        .withDefaultVertexShader()
+        .build();
+    auto& manager = program->uniformManager;
+
+    SECTION("Loads active uniforms after linking") {
+        CHECK_FALSE(manager.getUniformTable().empty());
+
+        auto info = manager.getUniformInfo("myFloat4x4");
+        REQUIRE(info.has_value());
+        CHECK(info->type == GL_FLOAT_MAT4);
+        CHECK(info->arraySize == 1);
+        CHECK(info->location ==
+            glGetUniformLocation(manager.programID, "myFloat4x4"));
+    }
+
+    SECTION("Resolves array uniforms and elements") {
+        auto info = manager.getUniformInfo("myFloatArray");
+        REQUIRE(info.has_value());
+        CHECK(info->arraySize == 4);
+        CHECK(manager.getUniformInfo("myFloatArray[0]").has_value());
+
+        CHECK(manager.getUniformLocation("myFloatArray[3]") ==
+            glGetUniformLocation(manager.programID, "myFloatArray[3]"));
+        CHECK(manager.getUniformLocation("myFloatArray[4]") == -1);
+        CHECK(manager.getUniformLocation("myFloatArray[x]") == -1);
+    }
+
+    SECTION("Resolves members of arrays of structs") {
+        auto structProgram = GLShaderProgram::Builder()
+            .withFragmentShaderFromFile(std::filesystem::path(TEST_DIR)
+                / "OpenGL/assets/test-struct.frag")
+            .withDefaultVertexShader()
+            .build();
+        auto& structManager = structProgram->uniformManager;
+        GLuint ID = structManager.programID;
+
+        CHECK(structManager.getUniformLocation("lights[1].color") ==
+            glGetUniformLocation(ID, "lights[1].color"));
+        CHECK(structManager.getUniformLocation("lights[1].values[1]") ==
+            glGetUniformLocation(ID, "lights[1].values[1]"));
+        CHECK(structManager.getUniformLocation("lights[2].color") == -1);
+
+        structManager.setUniform(std::make_shared<GLUniformVector<float>>(
+            std::vector<float>({ 1.f, 2.f, 3.f }), "lights[1].color"));
+        float result[3] = { 0.f, 0.f, 0.f };
+        glGetUniformfv(ID, glGetUniformLocation(ID, "lights[1].color"),
+            result);
+        CHECK(result[2] == 3.f);
+    }
+
+    SECTION("Clears table") {
+        manager.clearUniformTable();
+
+        CHECK(manager.getUniformTable().empty());
+        CHECK(manager.getUniformLocation("myFloat1") == -1);
+    }
+
+    SECTION("Reloads table when program is relinked") {
+        program->setFragmentShader(
+            std::make_shared<GLFragmentShader>(std::string(validShaderCode)));
+
+        CHECK_FALSE(manager.getUniformInfo("myFloat1").has_value());
+    }
+}
+
+TEST_CASE("OpenGL_GLProgramUniformManager_uploadStats") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(fragmentPath)
+        .withDefaultVertexShader()
+        .build();
+    auto& manager = program->uniformManager;
+    manager.resetUploadStats();
+
+    SECTION("Skips uploading unchanged values") {
+        manager.setUniform(std::make_shared<GLUniformScalar<int>>(1, "myInt1"));
+        manager.setUniform(std::make_shared<GLUniformScalar<int>>(1, "myInt1"));
+
+        CHECK(manager.getUploadStats().uploads == 1);
+        CHECK(manager.getUploadStats().skips == 1);
+
+        manager.setUniform(std::make_shared<GLUniformScalar<int>>(2, "myInt1"));
+        CHECK(manager.getUploadStats().uploads == 2);
+    }
+
+    SECTION("Detects changes behind pointer uniforms") {
+        float value = 1.f;
+        auto uniform = std::make_shared<basil::GLUniformPointer<float>>(
+            &value, "myFloat1");
+
+        manager.setUniform(uniform);
+        manager.setUniform(uniform);
+        CHECK(manager.getUploadStats().uploads == 1);
+
+        value = 2.f;
+        manager.setUniform(uniform);
+        CHECK(manager.getUploadStats().uploads == 2);
+    }
+
+    SECTION("Uploads array again after setting an element") {
+        auto array = std::make_shared<GLUniformVector<float>>(
+            std::vector<float>({ 1.f, 2.f, 3.f, 4.f }),
+            "myFloatArray", 1, 1, 4);
+
+        manager.setUniform(array);
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<float>>(9.f, "myFloatArray[1]"));
+        manager.setUniform(array);
+        CHECK(manager.getUploadStats().uploads == 3);
+
+        float result = 0.f;
+        glGetUniformfv(manager.programID,
+            glGetUniformLocation(manager.programID, "myFloatArray[1]"),
+            &result);
+        CHECK(result == 2.f);
+
+        // Element cache is patched by the write of the whole array
+        manager.setUniform(
+            std::make_shared<GLUniformScalar<float>>(9.f, "myFloatArray[1]"));
+        CHECK(manager.getUploadStats().uploads == 4);
+    }
+
+    SECTION("Uploads again after relinking") {
+        manager.setUniform(std::make_shared<GLUniformScalar<int>>(1, "myInt1"));
+        program->compile();
+
+        CHECK(manager.getUploadStats().uploads == 2);
+        CHECK(manager.getUploadStats().skips == 0);
+    }
+}
+
+TEST_CASE("OpenGL_GLProgramUniformManager_bindTextures") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(fragmentPath)
+        .withDefaultVertexShader()
+        .build();
+    auto& manager = program->uniformManager;
+    auto& allocator = GLTextureUnitAllocator::get();
+    allocator.setUnitLimit(1);
+
+    auto texture = std::make_shared<GLTexture2D>();
+    manager.setUniform(
+        std::make_shared<GLUniformTexture>(texture, "testTex"));
+
+    SECTION("Rebinds texture whose unit was reused") {
+        auto otherTexture = GLTexture2D();
+        manager.bindTextures();
+
+        GLint boundTexture = 0, result = -1;
+        glActiveTexture(GL_TEXTURE0);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &boundTexture);
+        glGetUniformiv(manager.programID,
+            glGetUniformLocation(manager.programID, "testTex"), &result);
+
+        CHECK(static_cast<GLuint>(boundTexture) == texture->getID());
+        CHECK(result == 0);
+    }
+
+    SECTION("Skips samplers not used by program") {
+        auto unusedTexture = std::make_shared<GLTexture2D>();
+        manager.setUniform(
+            std::make_shared<GLUniformTexture>(unusedTexture, "unusedTex"));
+        manager.bindTextures();
+
+        CHECK(allocator.residentUnits.contains(texture->getID()));
+        CHECK_FALSE(allocator.residentUnits.contains(
+            unusedTexture->getID()));
+    }
+
+    allocator.setUnitLimit(UINT32_MAX);
+}
+
 TEST_CASE("OpenGL_GLProgramUniformManager_applyCachedUniforms") {
     auto program = GLShaderProgram::Builder()
         .withFragmentShaderFromFile(fragmentPath)
@@ -0,0 +1,40 @@
+#include <catch.hpp>
+
+#include "OpenGL/GLResourceRegistry.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::GLResourceRegistry;
+
+TEST_CASE("OpenGL_GLResourceRegistry_getFragmentShader") { BASIL_LOCK_TEST
+    auto& registry = GLResourceRegistry::get();
+    auto shader = registry.getFragmentShader(validShaderCode);
+
+    SECTION("Compiles shader from code") {
+        CHECK(shader->hasCompiledSuccessfully());
+    }
+
+    SECTION("Reuses shader with equal code") {
+        CHECK(registry.getFragmentShader(validShaderCode) == shader);
+    }
+
+    SECTION("Keeps vertex and fragment shaders apart") {
+        auto vertexShader = registry.getVertexShader(validShaderCode);
+        CHECK(vertexShader->getID() != shader->getID());
+    }
+
+    SECTION("Releases shader once no longer used") {
+        auto size = registry.getSize();
+        shader = nullptr;
+        CHECK(registry.getSize() == size - 1);
+    }
+}
+
+TEST_CASE("OpenGL_GLResourceRegistry_getScreenGeometry") { BASIL_LOCK_TEST
+    auto& registry = GLResourceRegistry::get();
+
+    SECTION("Shares one vertex array") {
+        auto geometry = registry.getScreenGeometry();
+        CHECK(registry.getScreenGeometry() == geometry);
+    }
+}
@@ -0,0 +1,37 @@
+#include <catch.hpp>
+
+#include "OpenGL/GLScreenGeometry.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::GLScreenGeometry;
+
+TEST_CASE("OpenGL_GLScreenGeometry_GLScreenGeometry") { BASIL_LOCK_TEST
+    GLScreenGeometry geometry = GLScreenGeometry();
+
+    SECTION("Creates vertex array and buffers") {
+        CHECK(geometry.vertexArrayID > 0);
+        CHECK(geometry.vertexBufferID > 0);
+        CHECK(geometry.elementBufferID > 0);
+    }
+}
+
+TEST_CASE("OpenGL_GLScreenGeometry_draw") { BASIL_LOCK_TEST
+    GLScreenGeometry geometry = GLScreenGeometry();
+
+    SECTION("Binds vertex array for quad") {
+        geometry.draw(true);
+
+        GLint ID;
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &ID);
+        CHECK(geometry.getVertexArrayID() == (GLuint)ID);
+    }
+
+    SECTION("Binds vertex array for fullscreen triangle") {
+        geometry.draw(false);
+
+        GLint ID;
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &ID);
+        CHECK(geometry.getVertexArrayID() == (GLuint)ID);
+    }
+}
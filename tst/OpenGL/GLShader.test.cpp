@@ -35,6 +35,16 @@ TEST_CASE("OpenGL_GLShader_getShaderFromFile") { BASIL_LOCK_TEST
         CHECK(shader.rawShaderCode.ends_with(GLShader::SHADERTOY_SUFFIX));
     }
 
+    SECTION("Resolves includes and injects defines") {
+        auto includePath = std::filesystem::path(TEST_DIR)
+            / "OpenGL/assets/test-include.frag";
+        shader.getShaderFromFile(includePath, {{ "MAX_BOUNCES", "4" }});
+
+        CHECK(shader.getDependencies().size() == 2);
+        CHECK(shader.rawShaderCode.find("#define MAX_BOUNCES 4")
+            != std::string::npos);
+    }
+
     SECTION("Prints error for missing file") {
         shader.getShaderFromFile(invalidPath);
 
@@ -156,3 +166,29 @@ TEST_CASE("OpenGL_GLFragmentShader_debugShader") { BASIL_LOCK_TEST
         CHECK(shader->hasCompiledSuccessfully());
     }
 }
+
+TEST_CASE("OpenGL_GLShader_CompileMode") { BASIL_LOCK_TEST
+    SECTION("Checks compile result when requested in parallel mode") {
+        auto shader = GLFragmentShader(
+            fragmentPath, GLShader::CompileMode::PARALLEL);
+        CHECK(shader.isStatusPending);
+
+        while (!shader.isCompileComplete()) {}
+        CHECK(shader.hasCompiledSuccessfully());
+        CHECK_FALSE(shader.isStatusPending);
+    }
+
+    SECTION("Reports failure of parallel compile") {
+        auto shader = GLFragmentShader(
+            badFragmentPath, GLShader::CompileMode::PARALLEL);
+
+        CHECK_FALSE(shader.hasCompiledSuccessfully());
+    }
+
+    SECTION("Checks compile result immediately in blocking mode") {
+        auto shader = GLFragmentShader(fragmentPath);
+
+        CHECK_FALSE(shader.isStatusPending);
+        CHECK(shader.isCompileComplete());
+    }
+}
@@ -34,17 +34,14 @@ TEST_CASE("OpenGL_GLShaderPane_GLShaderPane") {
         GLShaderPane pane = GLShaderPane(
             props, shaderProgram);
 
-        CHECK(pane.vertexAttributeID > 0);
-        CHECK(pane.vertexBufferID > 0);
-        CHECK(pane.elementBufferID > 0);
+        REQUIRE_FALSE(pane.screenGeometry == nullptr);
+        CHECK(pane.screenGeometry->getVertexArrayID() > 0);
     }
 
     SECTION("Creates uninitialized pane") {
         GLShaderPane pane = GLShaderPane();
 
-        CHECK(pane.vertexAttributeID == 0);
-        CHECK(pane.vertexBufferID == 0);
-        CHECK(pane.elementBufferID == 0);
+        CHECK(pane.screenGeometry == nullptr);
     }
 }
 
@@ -54,9 +51,7 @@ TEST_CASE("OpenGL_GLShaderPane_setShaderProgram") {
         pane.setShaderProgram(nullptr);
 
         CHECK(pane.currentShaderProgram == nullptr);
-        CHECK(pane.vertexAttributeID == 0);
-        CHECK(pane.vertexBufferID == 0);
-        CHECK(pane.elementBufferID == 0);
+        CHECK(pane.screenGeometry == nullptr);
     }
 
     SECTION("Sets up OpenGL objects if new shader program provided") {
@@ -71,9 +66,7 @@ TEST_CASE("OpenGL_GLShaderPane_setShaderProgram") {
         pane.setShaderProgram(program);
 
         CHECK(pane.currentShaderProgram == program);
-        CHECK_FALSE(pane.vertexAttributeID == 0);
-        CHECK_FALSE(pane.vertexBufferID == 0);
-        CHECK_FALSE(pane.elementBufferID == 0);
+        CHECK_FALSE(pane.screenGeometry == nullptr);
     }
 
     SECTION("Replaces previous program if one exists") { BASIL_LOCK_TEST
@@ -92,20 +85,28 @@ TEST_CASE("OpenGL_GLShaderPane_setShaderProgram") {
         pane.setShaderProgram(program);
         CHECK(pane.currentShaderProgram == program);
 
-        CHECK_FALSE(pane.vertexAttributeID == 0);
-        CHECK_FALSE(pane.vertexBufferID == 0);
-        CHECK_FALSE(pane.elementBufferID == 0);
-
-        unsigned int VAO = pane.vertexAttributeID;
-        unsigned int VBO = pane.vertexBufferID;
-        unsigned int EBO = pane.elementBufferID;
+        REQUIRE_FALSE(pane.screenGeometry == nullptr);
+        auto screenGeometry = pane.screenGeometry;
 
         pane.setShaderProgram(anotherProgram);
         CHECK(pane.currentShaderProgram == anotherProgram);
+        CHECK(pane.screenGeometry == screenGeometry);
+    }
+
+    SECTION("Shares screen geometry between panes") { BASIL_LOCK_TEST
+        auto program =
+            GLShaderProgram::Builder()
+                .withFragmentShaderFromFile(fragmentPath)
+                .withDefaultVertexShader()
+                .build();
 
-        CHECK(pane.vertexAttributeID == VAO);
-        CHECK(pane.vertexBufferID == VBO);
-        CHECK(pane.elementBufferID == EBO);
+        GLShaderPane pane = GLShaderPane();
+        GLShaderPane anotherPane = GLShaderPane();
+        pane.setShaderProgram(program);
+        anotherPane.setShaderProgram(program);
+
+        REQUIRE_FALSE(pane.screenGeometry == nullptr);
+        CHECK(pane.screenGeometry == anotherPane.screenGeometry);
     }
 
     SECTION("Subscribes/unsubscribes data subscribers") { BASIL_LOCK_TEST
@@ -165,7 +166,7 @@ TEST_CASE("OpenGL_GLShaderPane_draw") { BASIL_LOCK_TEST
         GLint ID;
         glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &ID);
 
-        CHECK(pane.vertexAttributeID == (unsigned int)ID);
+        CHECK(pane.screenGeometry->getVertexArrayID() == (unsigned int)ID);
     }
 }
 
@@ -204,6 +205,36 @@ TEST_CASE("OpenGL_GLShaderPane_Builder") { BASIL_LOCK_TEST
             fragmentShader->rawShaderCode == validShaderCode);
     }
 
+    SECTION("Shares shader but not program between panes") {
+        auto pane = GLShaderPane::Builder()
+            .fromShaderCode(validShaderCode)
+            .build();
+        auto anotherPane = GLShaderPane::Builder()
+            .fromShaderCode(validShaderCode)
+            .build();
+
+        REQUIRE_FALSE(pane->currentShaderProgram == nullptr);
+        REQUIRE_FALSE(anotherPane->currentShaderProgram == nullptr);
+        CHECK(pane->currentShaderProgram->fragmentShader
+            == anotherPane->currentShaderProgram->fragmentShader);
+        CHECK(pane->currentShaderProgram
+            != anotherPane->currentShaderProgram);
+    }
+
+    SECTION("Keeps uniforms of panes built from same file apart") {
+        auto pane = GLShaderPane::Builder()
+            .fromShaderFile(fragmentPath)
+            .build();
+        auto anotherPane = GLShaderPane::Builder()
+            .fromShaderFile(fragmentPath)
+            .build();
+
+        REQUIRE_FALSE(pane->currentShaderProgram == nullptr);
+        REQUIRE_FALSE(anotherPane->currentShaderProgram == nullptr);
+        CHECK(pane->currentShaderProgram->getID()
+            != anotherPane->currentShaderProgram->getID());
+    }
+
     SECTION("Builds with shader program") {
         s_p<GLVertexShader> vertexShader =
             std::make_shared<GLVertexShader>(vertexPath);
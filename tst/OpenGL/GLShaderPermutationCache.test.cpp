@@ -0,0 +1,76 @@
+#include <catch.hpp>
+
+#include "OpenGL/GLShaderPermutationCache.hpp"
+
+#include "File/FileTestUtils.hpp"
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::GLShaderDefines;
+using basil::GLShaderPermutationCache;
+
+TEST_CASE("OpenGL_GLShaderPermutationCache_getFragmentShader") { BASIL_LOCK_TEST
+    auto& cache = GLShaderPermutationCache::get();
+    auto includePath = std::filesystem::path(TEST_DIR)
+        / "OpenGL/assets/test-include.frag";
+
+    auto shader = cache.getFragmentShader(includePath);
+
+    SECTION("Compiles shader from preprocessed file") {
+        CHECK(shader->hasCompiledSuccessfully());
+        CHECK(shader->getDependencies().size() == 2);
+    }
+
+    SECTION("Reuses variant with equal source and defines") {
+        auto other = cache.getFragmentShader(includePath);
+        CHECK(other == shader);
+    }
+
+    SECTION("Compiles separate variant for other defines") {
+        auto variant = cache.getFragmentShader(includePath,
+            GLShaderDefines { { "MAX_BOUNCES", "4" } });
+
+        CHECK(variant != shader);
+        CHECK(variant->hasCompiledSuccessfully());
+        CHECK(cache.getFragmentShader(includePath,
+            GLShaderDefines { { "MAX_BOUNCES", "4" } }) == variant);
+    }
+
+    SECTION("Compiles separate variant for copy at other path") {
+        auto copyPath = FileTestUtils::setUpTempDir("permutation.frag");
+        std::filesystem::copy_file(fragmentPath, copyPath);
+
+        auto original = cache.getFragmentShader(fragmentPath);
+        auto copy = cache.getFragmentShader(copyPath);
+
+        CHECK(copy != original);
+        REQUIRE(copy->getDependencies().size() == 1);
+        CHECK(copy->getDependencies().front()
+            == std::filesystem::absolute(copyPath).lexically_normal());
+    }
+
+    SECTION("Reuses ShaderToy variant") {
+        auto shaderToy = cache.getFragmentShader(shaderToyPath);
+        CHECK(cache.getFragmentShader(shaderToyPath) == shaderToy);
+    }
+
+    SECTION("Releases variant once no longer used") {
+        auto size = cache.getSize();
+        shader = nullptr;
+        CHECK(cache.getSize() == size - 1);
+    }
+
+    SECTION("Builds uncached shader for missing file") {
+        auto missing = cache.getFragmentShader(invalidPath);
+        CHECK_FALSE(missing->hasCompiledSuccessfully());
+    }
+}
+
+TEST_CASE("OpenGL_GLShaderPermutationCache_getVertexShader") { BASIL_LOCK_TEST
+    auto& cache = GLShaderPermutationCache::get();
+
+    SECTION("Reuses vertex shader variant") {
+        auto shader = cache.getVertexShader(vertexPath);
+        CHECK(shader->hasCompiledSuccessfully());
+        CHECK(cache.getVertexShader(vertexPath) == shader);
+    }
+}
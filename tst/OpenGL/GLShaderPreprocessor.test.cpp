@@ -0,0 +1,163 @@
+#include <catch.hpp>
+
+#include "OpenGL/GLShaderPreprocessor.hpp"
+
+using basil::GLShaderDefines;
+using basil::GLShaderPreprocessor;
+
+inline std::filesystem::path assetsPath =
+    std::filesystem::path(TEST_DIR) / "OpenGL/assets";
+inline std::filesystem::path includePath =
+    assetsPath / "test-include.frag";
+inline std::filesystem::path commonPath =
+    assetsPath / "include/common.glsl";
+
+static std::filesystem::path normalPath(const std::filesystem::path& path) {
+    return std::filesystem::absolute(path).lexically_normal();
+}
+
+TEST_CASE("OpenGL_GLShaderPreprocessor_processFile") {
+    auto preprocessor = GLShaderPreprocessor();
+
+    SECTION("Reads file without directives unchanged") {
+        auto source = preprocessor.processFile(
+            assetsPath / "valid-file.txt");
+
+        REQUIRE(source.has_value());
+        CHECK(source->code == "test-message");
+        CHECK(source->dependencies.size() == 1);
+    }
+
+    SECTION("Expands includes with #line directives") {
+        auto source = preprocessor.processFile(includePath);
+
+        REQUIRE(source.has_value());
+        CHECK(source->code ==
+            "#version 450 core\n"
+            "#line 1 1\n"
+            "\n"
+            "vec4 commonColor() { return vec4(1.0); }\n"
+            "#line 3 0\n"
+            "#line 4 0\n"
+            "out vec4 FragColor;\n"
+            "void main() { FragColor = commonColor(); }\n");
+    }
+
+    SECTION("Lists root file and includes as dependencies") {
+        auto source = preprocessor.processFile(includePath);
+
+        REQUIRE(source.has_value());
+        REQUIRE(source->dependencies.size() == 2);
+        CHECK(source->dependencies[0] == normalPath(includePath));
+        CHECK(source->dependencies[1] == normalPath(commonPath));
+    }
+
+    SECTION("Resolves includes from include directories") {
+        auto directoryPath = assetsPath / "test-include-directory.frag";
+        CHECK_FALSE(preprocessor.processFile(directoryPath).has_value());
+
+        preprocessor.addIncludeDirectory(assetsPath / "include");
+        auto source = preprocessor.processFile(directoryPath);
+        REQUIRE(source.has_value());
+        CHECK(source->dependencies.back() == normalPath(commonPath));
+    }
+
+    SECTION("Fails for recursive include") {
+        auto source = preprocessor.processFile(
+            assetsPath / "test-include-recursive.frag");
+        CHECK_FALSE(source.has_value());
+    }
+
+    SECTION("Fails for missing include") {
+        auto source = preprocessor.processFile(
+            assetsPath / "test-include-missing.frag");
+        CHECK_FALSE(source.has_value());
+    }
+
+    SECTION("Fails for missing file") {
+        auto source = preprocessor.processFile(
+            assetsPath / "missing-file.txt");
+        CHECK_FALSE(source.has_value());
+    }
+}
+
+TEST_CASE("OpenGL_GLShaderPreprocessor_setDefine") {
+    auto preprocessor = GLShaderPreprocessor();
+    auto plain = preprocessor.processFile(includePath);
+
+    preprocessor.setDefine("MAX_BOUNCES", "4");
+    preprocessor.setDefine("RENDER_SHADOWS");
+    auto defined = preprocessor.processFile(includePath);
+
+    REQUIRE(plain.has_value());
+    REQUIRE(defined.has_value());
+
+    SECTION("Injects defines after #version directive") {
+        CHECK(defined->code.starts_with(
+            "#version 450 core\n"
+            "#define MAX_BOUNCES 4\n"
+            "#define RENDER_SHADOWS\n"
+            "#line 2 0\n"
+            "#line 1 1\n"));
+    }
+
+    SECTION("Hashes source before defines are injected") {
+        CHECK(defined->sourceHash == plain->sourceHash);
+        CHECK(defined->code != plain->code);
+    }
+
+    SECTION("Prepends defines to source without #version directive") {
+        auto source = preprocessor.processFile(
+            assetsPath / "valid-file.txt");
+
+        REQUIRE(source.has_value());
+        CHECK(source->code ==
+            "#define MAX_BOUNCES 4\n"
+            "#define RENDER_SHADOWS\n"
+            "#line 1 0\n"
+            "test-message");
+    }
+
+    SECTION("Constructs with defines") {
+        auto other = GLShaderPreprocessor(GLShaderDefines {
+            { "MAX_BOUNCES", "4" }, { "RENDER_SHADOWS", "" }
+        });
+        CHECK(other.processFile(includePath)->code == defined->code);
+    }
+}
+
+TEST_CASE("OpenGL_GLShaderPreprocessor_freezeUniforms") {
+    std::string code =
+        "#version 450 core\n"
+        "uniform int MAX_BOUNCES;\n"
+        "uniform vec2 offset = vec2(0.);\n"
+        "layout(location = 4) uniform bool RENDER_SHADOWS;\n"
+        "uniform float scale;\n"
+        "void main() {}\n";
+
+    SECTION("Rewrites uniforms with values into constants") {
+        auto count = GLShaderPreprocessor::freezeUniforms(code, {
+            { "MAX_BOUNCES", "4" },
+            { "offset", "1.0, 0.5" },
+            { "RENDER_SHADOWS", "1" }
+        });
+
+        CHECK(count == 3);
+        CHECK(code ==
+            "#version 450 core\n"
+            "const int MAX_BOUNCES = int(4);\n"
+            "const vec2 offset = vec2(1.0, 0.5);\n"
+            "const bool RENDER_SHADOWS = bool(1);\n"
+            "uniform float scale;\n"
+            "void main() {}\n");
+    }
+
+    SECTION("Skips names which are not declared as uniforms") {
+        auto count = GLShaderPreprocessor::freezeUniforms(code, {
+            { "MAX", "4" }, { "missing", "1.0" }
+        });
+
+        CHECK(count == 0);
+        CHECK(code.find("const") == std::string::npos);
+    }
+}
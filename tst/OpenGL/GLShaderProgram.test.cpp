@@ -41,6 +41,20 @@ TEST_CASE("OpenGL_GLShaderProgram_GLShaderProgram") { BASIL_LOCK_TEST
         CHECK(shaderProgram.hasLinkedSuccessfully());
     }
 
+    SECTION("Detects vertex attributes of linked program") {
+        auto withAttributes = GLShaderProgram::Builder()
+            .withVertexShaderFromFile(vertexPath)
+            .withFragmentShaderFromFile(fragmentPath)
+            .build();
+        auto withoutAttributes = GLShaderProgram::Builder()
+            .withDefaultVertexShader()
+            .withFragmentShaderFromFile(fragmentPath)
+            .build();
+
+        CHECK(withAttributes->hasVertexAttributes());
+        CHECK_FALSE(withoutAttributes->hasVertexAttributes());
+    }
+
     SECTION("Logs error for failed compilation.") {
         auto vertexShader =
             std::make_shared<GLVertexShader>(vertexPath);
@@ -150,6 +164,51 @@ TEST_CASE("OpenGL_GLShaderProgram_receiveData") {
         shaderProgram.receiveData(message);
         CHECK(manager.uniformCache.size() == 1);
     }
+
+    SECTION("Skips model uniforms which have not changed") {
+        unsigned int ID = dataModel.addUniform(true, "myBool");
+        shaderProgram.receiveData(DataMessage(dataModel));
+        auto cached = manager.uniformCache.at("myBool");
+
+        dataModel.addUniform(1.5f, "myFloat");
+        shaderProgram.receiveData(DataMessage(dataModel));
+        CHECK(manager.uniformCache.size() == 2);
+        CHECK(manager.uniformCache.at("myBool") == cached);
+
+        dataModel.setUniformValue(false, ID);
+        shaderProgram.receiveData(DataMessage(dataModel));
+        CHECK(manager.uniformCache.at("myBool") != cached);
+    }
+
+    SECTION("Sets uniforms from delta") {
+        dataModel.addUniform(true, "myBool");
+        uint64_t version = dataModel.getVersion();
+        dataModel.addUniform(1.5f, "myFloat");
+
+        shaderProgram.receiveData(DataMessage(dataModel.getDelta(version)));
+        CHECK(manager.uniformCache.size() == 1);
+        CHECK(manager.uniformCache.contains("myFloat"));
+    }
+
+    SECTION("Keeps version after skipped delta until full model") {
+        unsigned int ID = dataModel.addUniform(true, "myBool");
+        shaderProgram.receiveData(DataMessage(dataModel));
+        uint64_t applied = dataModel.getVersion();
+
+        dataModel.addUniform(1.5f, "myFloat");
+        uint64_t missed = dataModel.getVersion();
+        dataModel.setUniformValue(false, ID);
+        shaderProgram.receiveData(DataMessage(dataModel.getDelta(missed)));
+
+        unsigned int modelID = dataModel.getModelID();
+        CHECK(shaderProgram.getModelVersion(modelID) == applied);
+        CHECK_FALSE(manager.uniformCache.contains("myFloat"));
+
+        shaderProgram.receiveData(DataMessage(dataModel));
+        CHECK(shaderProgram.getModelVersion(modelID)
+            == dataModel.getVersion());
+        CHECK(manager.uniformCache.contains("myFloat"));
+    }
 }
 
 TEST_CASE("OpenGL_GLShaderProgram_Builder") { BASIL_LOCK_TEST
@@ -199,3 +258,120 @@ TEST_CASE("OpenGL_GLShaderProgram_Builder") { BASIL_LOCK_TEST
         CHECK_FALSE(program->getID() == 0);
     }
 }
+
+TEST_CASE("OpenGL_GLShaderProgram_CompileMode") { BASIL_LOCK_TEST
+    auto vertexShader = std::make_shared<GLVertexShader>(vertexPath);
+    auto fragmentShader = std::make_shared<GLFragmentShader>(fragmentPath);
+
+    SECTION("Checks link result when requested in parallel mode") {
+        auto program = GLShaderProgram(vertexShader, fragmentShader,
+            basil::GLShader::CompileMode::PARALLEL);
+        CHECK(program.isStatusPending);
+
+        while (!program.isLinkComplete()) {}
+        CHECK(program.hasLinkedSuccessfully());
+        CHECK_FALSE(program.isStatusPending);
+    }
+
+    SECTION("Copies uniforms and model versions from other program") {
+        auto previous = GLShaderProgram(vertexShader, fragmentShader);
+        auto model = ShaderUniformModel();
+        model.addUniform(1.f, "myFloat1");
+        previous.receiveData(DataMessage(model));
+
+        auto program = GLShaderProgram(vertexShader, fragmentShader);
+        program.copyUniformsFrom(previous);
+
+        CHECK(program.uniformManager.uniformCache.contains("myFloat1"));
+        CHECK(program.getModelVersion(model.getModelID())
+            == model.getVersion());
+    }
+}
+
+TEST_CASE("OpenGL_GLShaderProgram_hasUniformBlock") { BASIL_LOCK_TEST
+    auto vertexShader = std::make_shared<GLVertexShader>(vertexPath);
+    auto fragmentShader = std::make_shared<GLFragmentShader>(
+        std::filesystem::path(TEST_DIR) / "OpenGL/assets/test-block.frag");
+
+    SECTION("Looks up reflected blocks without creating buffers") {
+        auto program = GLShaderProgram(vertexShader, fragmentShader);
+
+        CHECK(program.hasUniformBlock("TestBlock"));
+        CHECK_FALSE(program.hasUniformBlock("OtherBlock"));
+        CHECK(program.uniformBuffers.empty());
+    }
+
+    SECTION("Returns false without waiting while link is pending") {
+        auto program = GLShaderProgram(vertexShader, fragmentShader,
+            basil::GLShader::CompileMode::PARALLEL);
+
+        CHECK_FALSE(program.hasUniformBlock("TestBlock"));
+        CHECK(program.isStatusPending);
+
+        CHECK(program.hasLinkedSuccessfully());
+        CHECK(program.hasUniformBlock("TestBlock"));
+    }
+}
+
+TEST_CASE("OpenGL_GLShaderProgram_freezeUniform") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(fragmentPath)
+        .withDefaultVertexShader()
+        .withFrozenUniform("myInt1")
+        .build();
+    program->setUniform(std::make_shared<GLUniformScalar<int>>(3, "myInt1"));
+
+    auto waitForSpecialization = [&]() {
+        for (int frame = 0; frame < 1000; frame++) {
+            program->use();
+            if (!program->pendingSpecialization) break;
+        }
+    };
+
+    SECTION("Compiles program with uniform as constant") {
+        program->use();
+        REQUIRE(program->pendingSpecialization);
+        CHECK(program->pendingSpecialization->getFragmentShader()
+            ->getShaderCode().find("const int myInt1 = int(3);")
+            != std::string::npos);
+
+        waitForSpecialization();
+        CHECK(program->isSpecialized());
+    }
+
+    SECTION("Uses generic program until value is respecialized") {
+        waitForSpecialization();
+        REQUIRE(program->isSpecialized());
+
+        program->setUniform(
+            std::make_shared<GLUniformScalar<int>>(5, "myInt1"));
+        program->use();
+        CHECK_FALSE(program->isSpecialized());
+        CHECK(program->pendingSpecialization);
+    }
+
+    SECTION("Forwards other uniforms to specialized program") {
+        waitForSpecialization();
+        REQUIRE(program->isSpecialized());
+
+        program->setUniform(
+            std::make_shared<GLUniformScalar<float>>(1.f, "myFloat1"));
+        CHECK(program->specializedProgram->uniformManager
+            .uniformCache.contains("myFloat1"));
+    }
+
+    SECTION("Formats uniform values as GLSL constructor arguments") {
+        CHECK(GLShaderProgram::getConstantValues(
+            GLUniformScalar<float>(2.f, "a")) == "2.0");
+        CHECK(GLShaderProgram::getConstantValues(
+            GLUniformScalar<double>(0.1, "b")) == "0.1lf");
+        CHECK(GLShaderProgram::getConstantValues(
+            GLUniformScalar<unsigned int>(4, "c")) == "4");
+
+        float values[] = { 1.f, 0.5f };
+        CHECK(GLShaderProgram::getConstantValues(
+            basil::GLUniformPointer<float>(values, "d", 2)) == "1.0, 0.5");
+        CHECK_FALSE(GLShaderProgram::getConstantValues(
+            basil::GLUniformPointer<float>(values, "e", 1, 1, 2)));
+    }
+}
@@ -0,0 +1,113 @@
+#include <catch.hpp>
+
+#include "OpenGL/GLStateCache.hpp"
+#include "OpenGL/GLTexture.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::BasilContext;
+using basil::GLStateCache;
+using basil::GLTexture2D;
+
+TEST_CASE("OpenGL_GLStateCache_setViewport") { BASIL_LOCK_TEST
+    BasilContext::initialize();
+    auto& stateCache = GLStateCache::get();
+    stateCache.invalidate();
+    stateCache.resetCounts();
+
+    stateCache.setViewport(1, 2, 3, 4);
+
+    SECTION("Issues first call") {
+        GLint props[4];
+        glGetIntegerv(GL_VIEWPORT, props);
+        CHECK(props[0] == 1);
+        CHECK(props[1] == 2);
+        CHECK(props[2] == 3);
+        CHECK(props[3] == 4);
+        CHECK(stateCache.getIssuedCount() == 1);
+    }
+
+    SECTION("Skips call with unchanged value") {
+        stateCache.setViewport(1, 2, 3, 4);
+        CHECK(stateCache.getIssuedCount() == 1);
+        CHECK(stateCache.getSkippedCount() == 1);
+    }
+
+    SECTION("Issues call with changed value") {
+        stateCache.setViewport(1, 2, 3, 5);
+        CHECK(stateCache.getIssuedCount() == 2);
+        CHECK(stateCache.getSkippedCount() == 0);
+    }
+
+    SECTION("Issues call again once invalidated") {
+        stateCache.invalidate();
+        stateCache.setViewport(1, 2, 3, 4);
+        CHECK(stateCache.getIssuedCount() == 2);
+    }
+}
+
+TEST_CASE("OpenGL_GLStateCache_checkContext") {
+    auto& stateCache = GLStateCache::get();
+
+    SECTION("Forgets state of previous context") {
+        {
+            BASIL_LOCK_TEST
+            BasilContext::initialize();
+            stateCache.setBlendFunc(GL_ONE, GL_ZERO);
+        }
+
+        BASIL_LOCK_TEST
+        BasilContext::initialize();
+        stateCache.resetCounts();
+        stateCache.setBlendFunc(GL_ONE, GL_ZERO);
+        CHECK(stateCache.getIssuedCount() == 1);
+    }
+}
+
+TEST_CASE("OpenGL_GLStateCache_bindTexture") { BASIL_LOCK_TEST
+    auto& stateCache = GLStateCache::get();
+    auto texture = GLTexture2D();
+    stateCache.resetCounts();
+
+    SECTION("Skips binding texture already bound") {
+        stateCache.bindTexture(
+            texture.getEnum(), GL_TEXTURE_2D, texture.getID());
+        CHECK(stateCache.getIssuedCount() == 0);
+        CHECK(stateCache.getSkippedCount() == 1);
+    }
+
+    SECTION("Activates unit and binds texture") {
+        stateCache.bindTexture(texture.getEnum(), GL_TEXTURE_2D, 0);
+
+        GLint activeTexture, textureID;
+        glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &textureID);
+        CHECK(static_cast<GLenum>(activeTexture) == texture.getEnum());
+        CHECK(textureID == 0);
+    }
+
+    SECTION("Forgets binding of released texture") {
+        stateCache.releaseTexture(texture.getID());
+        stateCache.bindTexture(
+            texture.getEnum(), GL_TEXTURE_2D, texture.getID());
+        CHECK(stateCache.getIssuedCount() == 1);
+    }
+}
+
+TEST_CASE("OpenGL_GLStateCache_useProgram") { BASIL_LOCK_TEST
+    BasilContext::initialize();
+    auto& stateCache = GLStateCache::get();
+    stateCache.useProgram(0);
+    stateCache.resetCounts();
+
+    SECTION("Skips using program already in use") {
+        stateCache.useProgram(0);
+        CHECK(stateCache.getSkippedCount() == 1);
+    }
+
+    SECTION("Forgets program once released") {
+        stateCache.releaseProgram(0);
+        stateCache.useProgram(0);
+        CHECK(stateCache.getIssuedCount() == 1);
+    }
+}
@@ -117,6 +117,192 @@ TEST_CASE("OpenGL_GLTexture_update") { BASIL_LOCK_TEST
     }
 }
 
+TEST_CASE("OpenGL_GLTexture_updateGLTexImage") { BASIL_LOCK_TEST
+    std::vector<float> data = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    auto source = std::make_shared<SpanTextureSource<float, 2, 1>>(
+        std::span(data));
+    source->setWidth(4);
+    source->setHeight(2);
+
+    GLTexture2D texture = GLTexture2D();
+    texture.setSource(source);
+
+    SECTION("Allocates immutable storage") {
+        GLint isImmutable = GL_FALSE;
+        glGetTexParameteriv(GL_TEXTURE_2D,
+            GL_TEXTURE_IMMUTABLE_FORMAT, &isImmutable);
+
+        CHECK(isImmutable == GL_TRUE);
+        CHECK(texture.uploadRing == nullptr);
+    }
+
+    SECTION("Streams repeated updates through upload ring") {
+        data.at(0) = 10;
+        texture.update();
+        data.at(0) = 20;
+        texture.update();
+
+        float result[8];
+        glGetTexImage(GL_TEXTURE_2D, 0, source->format.format,
+            source->format.type, result);
+
+        REQUIRE_FALSE(texture.uploadRing == nullptr);
+        CHECK(result[0] == 20);
+        CHECK(result[7] == 8);
+    }
+
+    SECTION("Replaces texture when source is resized") {
+        GLuint textureID = texture.getID();
+        source->setWidth(2);
+        texture.update();
+
+        CHECK(texture.getID() != textureID);
+        CHECK(texture.storageSize == std::array<int, 3> { 2, 2, 1 });
+
+        GLint result;
+        glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, &result);
+        CHECK(result == GL_CLAMP_TO_BORDER);
+    }
+
+    SECTION("Uploads only dirty regions") {
+        data = { 10, 20, 30, 40, 50, 60, 70, 80 };
+        source->markDirty({ 1, 1 }, { 2, 1 });
+        texture.update();
+
+        float result[8];
+        glGetTexImage(GL_TEXTURE_2D, 0, source->format.format,
+            source->format.type, result);
+
+        CHECK(result[0] == 1);
+        CHECK(result[4] == 5);
+        CHECK(result[5] == 60);
+        CHECK(result[6] == 70);
+        CHECK(result[7] == 8);
+        CHECK(source->getDirtyRegions().empty());
+    }
+
+    SECTION("Packs regions of one update into one ring region") {
+        texture.update();
+        REQUIRE_FALSE(texture.uploadRing == nullptr);
+        unsigned int region = texture.uploadRing->currentRegion;
+
+        data = { 10, 20, 30, 40, 50, 60, 70, 80 };
+        for (int x = 0; x < 4; x++) {
+            source->markDirty({ x, 0 }, { 1, 1 });
+            source->markDirty({ x, 1 }, { 1, 1 });
+        }
+        REQUIRE(source->getDirtyRegions().size()
+            > BASIL_TEXTURE_UPLOAD_BUFFER_COUNT);
+        texture.update();
+
+        float result[8];
+        glGetTexImage(GL_TEXTURE_2D, 0, source->format.format,
+            source->format.type, result);
+
+        auto& fences = texture.uploadRing->fences;
+        CHECK(texture.uploadRing->currentRegion
+            == (region + 1) % fences.size());
+        for (int i = 0; i < 8; i++) {
+            CHECK(result[i] == data.at(i));
+        }
+    }
+
+    SECTION("Clips dirty regions to texture") {
+        data = { 10, 20, 30, 40, 50, 60, 70, 80 };
+        source->markDirty({ 3, -1 }, { 4, 2 });
+        texture.update();
+
+        float result[8];
+        glGetTexImage(GL_TEXTURE_2D, 0, source->format.format,
+            source->format.type, result);
+
+        CHECK(result[2] == 3);
+        CHECK(result[3] == 40);
+        CHECK(result[7] == 8);
+    }
+
+    SECTION("Uploads whole texture when resized") {
+        source->setHeight(1);
+        source->markDirty({ 0, 0 }, { 1, 1 });
+        data.at(3) = 40;
+        texture.update();
+
+        float result[4];
+        glGetTexImage(GL_TEXTURE_2D, 0, source->format.format,
+            source->format.type, result);
+
+        CHECK(result[3] == 40);
+    }
+
+    SECTION("Skips upload for empty source") {
+        GLuint textureID = texture.getID();
+        source->setWidth(0);
+        texture.update();
+
+        CHECK(texture.getID() == textureID);
+    }
+}
+
+TEST_CASE("OpenGL_GLTexture_uploadRegion") { BASIL_LOCK_TEST
+    SECTION("Uploads dirty slab of 3D texture") {
+        std::vector<float> data = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        auto source = std::make_shared<SpanTextureSource<float, 3, 1>>(
+            std::span(data));
+        source->setWidth(2);
+        source->setHeight(2);
+        source->setDepth(2);
+
+        GLTexture3D texture = GLTexture3D();
+        texture.setSource(source);
+
+        data = { 10, 20, 30, 40, 50, 60, 70, 80 };
+        source->markDirty({ 0, 0, 1 }, { 2, 2, 1 });
+        texture.update();
+
+        float result[8];
+        glGetTexImage(GL_TEXTURE_3D, 0, source->format.format,
+            source->format.type, result);
+
+        CHECK(result[3] == 4);
+        CHECK(result[4] == 50);
+        CHECK(result[7] == 80);
+    }
+
+    SECTION("Uploads region of RGB8 texture with odd width") {
+        std::vector<unsigned char> data(27);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            data[i] = static_cast<unsigned char>(i);
+        }
+        auto source = std::make_shared<
+            SpanTextureSource<unsigned char, 2, 3>>(std::span(data));
+        source->setWidth(3);
+        source->setHeight(3);
+
+        GLTexture2D texture = GLTexture2D();
+        texture.setSource(source);
+
+        for (int y = 1; y < 3; y++) {
+            for (int x = 1; x < 3; x++) {
+                for (int channel = 0; channel < 3; channel++) {
+                    data[(y * 3 + x) * 3 + channel] += 100;
+                }
+            }
+        }
+        source->markDirty({ 1, 1 }, { 2, 2 });
+        texture.update();
+
+        unsigned char result[27];
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glGetTexImage(GL_TEXTURE_2D, 0, source->format.format,
+            source->format.type, result);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+        for (std::size_t i = 0; i < data.size(); i++) {
+            CHECK(result[i] == data[i]);
+        }
+    }
+}
+
 TEST_CASE("OpenGL_GLTexture_Builder") { BASIL_LOCK_TEST
     SECTION("Builds from file path") {
         auto path = std::filesystem::path(TEST_DIR)
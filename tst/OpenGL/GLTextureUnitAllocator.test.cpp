@@ -0,0 +1,69 @@
+#include <catch.hpp>
+
+#include "OpenGL/GLTextureUnitAllocator.hpp"
+#include "OpenGL/GLTexture.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::GLTexture2D;
+using basil::GLTextureUnitAllocator;
+using basil::Logger;
+using basil::LogLevel;
+
+TEST_CASE("OpenGL_GLTextureUnitAllocator_bind") { BASIL_LOCK_TEST
+    auto& allocator = GLTextureUnitAllocator::get();
+    allocator.setUnitLimit(2);
+
+    GLTexture2D first = GLTexture2D();
+    GLTexture2D second = GLTexture2D();
+
+    SECTION("Assigns free units first") {
+        CHECK(allocator.getUnitCount() == 2);
+        CHECK(first.getEnum() != second.getEnum());
+    }
+
+    SECTION("Keeps unit of resident texture") {
+        GLint unit = allocator.bind(GL_TEXTURE_2D, first.getID());
+
+        CHECK(unit == first.getUniformLocation());
+        CHECK(first.bindUnit() == unit);
+    }
+
+    SECTION("Reuses least recently used unit") {
+        first.bindUnit();
+        GLTexture2D third = GLTexture2D();
+
+        CHECK(third.getEnum() == second.getEnum());
+        CHECK(allocator.residentUnits.contains(first.getID()));
+        CHECK_FALSE(allocator.residentUnits.contains(second.getID()));
+    }
+
+    SECTION("Warns when all units are used by current draw") {
+        Logger& logger = Logger::get();
+        logger.clearTestInfo();
+
+        GLTexture2D third = GLTexture2D();
+        allocator.beginDraw();
+        first.bindUnit();
+        second.bindUnit();
+        CHECK(logger.getLastLevel() != LogLevel::WARN);
+
+        third.bindUnit();
+        allocator.endDraw();
+        CHECK(logger.getLastLevel() == LogLevel::WARN);
+    }
+
+    SECTION("Frees unit of deleted texture") {
+        GLenum unit;
+        {
+            GLTexture2D third = GLTexture2D();
+            unit = third.getEnum();
+        }
+        GLTexture2D fourth = GLTexture2D();
+
+        CHECK(fourth.getEnum() == unit);
+        CHECK(allocator.residentUnits.size() == 2);
+    }
+
+    allocator.setUnitLimit(UINT32_MAX);
+}
@@ -4,8 +4,31 @@
 
 #include "OpenGL/GLUniform.hpp"
 
+using basil::GLUniformInline;
+using basil::GLUniformScalar;
+using basil::GLUniformShapedType;
+using basil::GLUniformValue;
 using basil::GLUniformVector;
 
+struct TestDoubleMat2x3 { double values[6]; };
+struct TestBoolVec2 { bool x; bool y; };
+
+template<>
+struct basil::GLUniformShape<TestDoubleMat2x3> {
+    using Element = double;
+    static constexpr unsigned int Length = 3;
+    static constexpr unsigned int Width = 2;
+    static constexpr unsigned int Count = 1;
+};
+
+template<>
+struct basil::GLUniformShape<TestBoolVec2> {
+    using Element = bool;
+    static constexpr unsigned int Length = 2;
+    static constexpr unsigned int Width = 1;
+    static constexpr unsigned int Count = 1;
+};
+
 TEST_CASE("OpenGL_GLUniform_GLUniformVector") {
     std::vector<float> data = { 0.f, 1.f, 2.f, 3.f };
     std::vector<bool> bData = { true, false, true, false };
@@ -40,3 +63,93 @@ TEST_CASE("OpenGL_GLUniform_GLUniformVector") {
         CHECK(uniform.getCount() == 2);
     }
 }
+
+TEST_CASE("OpenGL_GLUniform_setValue") {
+    SECTION("Overwrites scalar value in place") {
+        auto uniform = GLUniformScalar<float>(1.f, "name");
+        void* data = uniform.getData();
+
+        uniform.setValue(2.f);
+        CHECK(uniform.getData() == data);
+        CHECK(*reinterpret_cast<float*>(uniform.getData()) == 2.f);
+    }
+
+    SECTION("Overwrites vector values in place if size is unchanged") {
+        auto uniform = GLUniformVector<float>({ 0.f, 1.f }, "name");
+        void* data = uniform.getData();
+
+        std::vector<float> values = { 2.f, 3.f };
+        uniform.setValue(values);
+        CHECK(uniform.getData() == data);
+        CHECK(reinterpret_cast<float*>(uniform.getData())[1] == 3.f);
+    }
+
+    SECTION("Stores fixed-size values inline") {
+        auto uniform = GLUniformInline<float, 2, 2>(
+            { 1.f, 2.f, 3.f, 4.f }, "name");
+        CHECK(uniform.getLength() == 2);
+        CHECK(uniform.getWidth() == 2);
+        CHECK(uniform.getCount() == 1);
+        CHECK(uniform.getDataSize() == 4 * sizeof(float));
+
+        std::vector<float> values = { 5.f, 6.f };
+        uniform.setValue(std::span<const float>(values));
+        float* data = reinterpret_cast<float*>(uniform.getData());
+        CHECK(data[0] == 5.f);
+        CHECK(data[1] == 6.f);
+        CHECK(data[2] == 3.f);
+    }
+
+    SECTION("Stores fixed-size booleans as integers") {
+        auto uniform = GLUniformInline<bool, 2>({ true, false }, "name");
+        CHECK(std::holds_alternative<basil::GLUniformSource<int>>(
+            uniform.getSource()));
+        CHECK(reinterpret_cast<int*>(uniform.getData())[0] == 1);
+    }
+}
+
+TEST_CASE("OpenGL_GLUniform_GLUniformValue") {
+    SECTION("Takes shape from GLUniformShape") {
+        auto uniform = GLUniformValue<TestDoubleMat2x3>(
+            { { 1., 2., 3., 4., 5., 6. } }, "name");
+        CHECK(uniform.getLength() == 3);
+        CHECK(uniform.getWidth() == 2);
+        CHECK(uniform.getCount() == 1);
+        CHECK(uniform.getDataSize() == 6 * sizeof(double));
+        CHECK(std::holds_alternative<basil::GLUniformSource<double>>(
+            uniform.getSource()));
+        CHECK(reinterpret_cast<double*>(uniform.getData())[5] == 6.);
+        CHECK(std::string(uniform.getSourceTypeName()) == "double");
+    }
+
+    SECTION("Multiplies count of fixed-size arrays") {
+        using Array = std::array<TestDoubleMat2x3, 4>;
+        auto uniform = GLUniformValue<Array>(Array(), "name");
+        CHECK(uniform.getLength() == 3);
+        CHECK(uniform.getWidth() == 2);
+        CHECK(uniform.getCount() == 4);
+    }
+
+    SECTION("Overwrites value in place") {
+        auto uniform = GLUniformValue<TestDoubleMat2x3>(
+            TestDoubleMat2x3(), "name");
+        void* data = uniform.getData();
+
+        uniform.setValue({ { 0., 0., 0., 0., 0., 7. } });
+        CHECK(uniform.getData() == data);
+        CHECK(reinterpret_cast<double*>(uniform.getData())[5] == 7.);
+    }
+
+    SECTION("Stores booleans as integers") {
+        auto uniform = GLUniformValue<TestBoolVec2>({ false, true }, "name");
+        CHECK(std::holds_alternative<basil::GLUniformSource<int>>(
+            uniform.getSource()));
+        CHECK(reinterpret_cast<int*>(uniform.getData())[1] == 1);
+    }
+
+    SECTION("Rejects types without shape or with padding") {
+        CHECK(GLUniformShapedType<TestDoubleMat2x3>);
+        CHECK_FALSE(GLUniformShapedType<float>);
+        CHECK_FALSE(GLUniformShapedType<std::array<float, 3>>);
+    }
+}
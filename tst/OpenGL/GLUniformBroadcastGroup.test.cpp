@@ -0,0 +1,157 @@
+#include <catch.hpp>
+
+#include "Data/ShaderUniformModel.hpp"
+#include "OpenGL/GLShaderProgram.hpp"
+#include "OpenGL/GLUniformBroadcastGroup.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::DataMessage;
+using basil::GLShaderProgram;
+using basil::GLUniformBroadcastGroup;
+using basil::GLUniformBuffer;
+using basil::ShaderUniformModel;
+
+inline std::filesystem::path broadcastBlockPath =
+    std::filesystem::path(TEST_DIR) / "OpenGL/assets/test-block.frag";
+
+static std::shared_ptr<GLShaderProgram> buildBlockProgram() {
+    return GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(broadcastBlockPath)
+        .withDefaultVertexShader()
+        .build();
+}
+
+TEST_CASE("OpenGL_GLUniformBroadcastGroup_addProgram") { BASIL_LOCK_TEST
+    auto first = buildBlockProgram();
+    auto second = buildBlockProgram();
+
+    auto group = GLUniformBroadcastGroup::Builder()
+        .withProgram(first)
+        .withProgram(second)
+        .build();
+
+    SECTION("Ignores duplicate and null programs") {
+        group->addProgram(first);
+        group->addProgram(nullptr);
+        CHECK(group->getPrograms().size() == 2);
+    }
+
+    SECTION("Sends current models to program added later") {
+        auto model = ShaderUniformModel();
+        model.addUniform(2.f, "myFloat1");
+        group->receiveData(DataMessage(model));
+
+        auto third = buildBlockProgram();
+        group->addProgram(third);
+
+        CHECK(third->getModelVersion(model.getModelID())
+            == model.getVersion());
+        CHECK(third->uniformManager.uniformCache.contains("myFloat1"));
+    }
+
+    SECTION("Removes program from group") {
+        group->removeProgram(first);
+        REQUIRE(group->getPrograms().size() == 1);
+        CHECK(group->getPrograms().front() == second);
+    }
+}
+
+TEST_CASE("OpenGL_GLUniformBroadcastGroup_receiveData") { BASIL_LOCK_TEST
+    auto first = buildBlockProgram();
+    auto second = buildBlockProgram();
+
+    auto group = GLUniformBroadcastGroup::Builder()
+        .withProgram(first)
+        .withProgram(second)
+        .build();
+
+    auto model = ShaderUniformModel();
+    model.setUniformBlock("TestBlock");
+    auto scale = model.addUniform(2.f, "blockScale");
+    auto value = model.addUniform(1.f, "myFloat1");
+
+    SECTION("Applies model to every program in group") {
+        group->receiveData(DataMessage(model));
+
+        for (const auto& program : group->getPrograms()) {
+            CHECK(program->getModelVersion(model.getModelID())
+                == model.getVersion());
+            CHECK(program->uniformManager.uniformCache.contains("myFloat1"));
+            CHECK(program->uniformBuffers.contains("TestBlock"));
+        }
+    }
+
+    SECTION("Writes block members once for whole group") {
+        group->receiveData(DataMessage(model));
+        model.setUniformValue(3.f, scale);
+        model.setUniformValue(4.f, value);
+        group->receiveData(DataMessage(model));
+
+        CHECK(group->remainder.uniforms.size() == 1);
+        CHECK(group->remainder.uniforms.front()->getName() == "myFloat1");
+
+        auto buffer = GLUniformBuffer::forBlock("TestBlock");
+        float* data = reinterpret_cast<float*>(buffer->staging.data());
+        CHECK(data[3] == 3.f);
+
+        CHECK(second->getModelVersion(model.getModelID())
+            == model.getVersion());
+    }
+
+    SECTION("Waits for full model after skipped delta") {
+        group->receiveData(DataMessage(model));
+        uint64_t applied = model.getVersion();
+
+        model.setUniformValue(3.f, scale);
+        uint64_t missed = model.getVersion();
+        model.setUniformValue(4.f, value);
+        group->receiveData(DataMessage(model.getDelta(missed)));
+
+        unsigned int modelID = model.getModelID();
+        CHECK(group->modelStates.at(modelID).version == applied);
+        for (const auto& program : group->getPrograms()) {
+            CHECK(program->getModelVersion(modelID) == applied);
+        }
+
+        group->receiveData(DataMessage(model));
+
+        auto buffer = GLUniformBuffer::forBlock("TestBlock");
+        float* data = reinterpret_cast<float*>(buffer->staging.data());
+        CHECK(data[3] == 3.f);
+        for (const auto& program : group->getPrograms()) {
+            CHECK(program->getModelVersion(modelID) == model.getVersion());
+        }
+    }
+
+    SECTION("Sends complete model to programs added later") {
+        group->receiveData(DataMessage(model));
+        model.setUniformValue(3.f, scale);
+
+        auto third = buildBlockProgram();
+        group->addProgram(third);
+        group->receiveData(DataMessage(model));
+
+        CHECK(third->getModelVersion(model.getModelID())
+            == model.getVersion());
+        CHECK(third->uniformManager.uniformCache.contains("myFloat1"));
+    }
+
+    SECTION("Uploads pointer uniforms of unchanged model again") {
+        float pointerValue = 1.f;
+        auto pointerModel = ShaderUniformModel();
+        pointerModel.addUniform(&pointerValue, "myFloat1");
+        group->receiveData(DataMessage(pointerModel));
+
+        pointerValue = 5.f;
+        group->receiveData(DataMessage(pointerModel));
+
+        for (const auto& program : group->getPrograms()) {
+            float result = 0.f;
+            glGetUniformfv(program->getID(),
+                glGetUniformLocation(program->getID(), "myFloat1"),
+                &result);
+            CHECK(result == 5.f);
+        }
+    }
+}
@@ -0,0 +1,178 @@
+#include <catch.hpp>
+
+#include "Data/ShaderUniformModel.hpp"
+#include "OpenGL/GLShaderProgram.hpp"
+#include "OpenGL/GLUniformBuffer.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::DataMessage;
+using basil::GLShaderProgram;
+using basil::GLUniformBuffer;
+using basil::GLUniformScalar;
+using basil::GLUniformVector;
+using basil::Logger;
+using basil::LogLevel;
+using basil::ShaderUniformModel;
+
+inline std::filesystem::path blockFragmentPath =
+    std::filesystem::path(TEST_DIR) / "OpenGL/assets/test-block.frag";
+
+TEST_CASE("OpenGL_GLUniformBuffer_forBlock") { BASIL_LOCK_TEST
+    SECTION("Shares buffer between callers with same block name") {
+        auto first = GLUniformBuffer::forBlock("TestBlock");
+        auto second = GLUniformBuffer::forBlock("TestBlock");
+        auto other = GLUniformBuffer::forBlock("OtherBlock");
+
+        CHECK(first == second);
+        CHECK(first != other);
+        CHECK(first->getBindingPoint() != other->getBindingPoint());
+    }
+
+    SECTION("Reuses binding points of destroyed buffers") {
+        auto first = GLUniformBuffer::forBlock("FirstBlock");
+        GLuint bindingPoint = first->getBindingPoint();
+        first = nullptr;
+
+        auto& freePoints = GLUniformBuffer::freeBindingPoints;
+        REQUIRE(freePoints.contains(bindingPoint));
+        GLuint lowestPoint = *freePoints.begin();
+        GLuint nextPoint = GLUniformBuffer::nextBindingPoint;
+
+        auto second = GLUniformBuffer::forBlock("SecondBlock");
+        CHECK(second->getBindingPoint() == lowestPoint);
+        CHECK(GLUniformBuffer::nextBindingPoint == nextPoint);
+    }
+}
+
+TEST_CASE("OpenGL_GLUniformBuffer_attachProgram") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(blockFragmentPath)
+        .withDefaultVertexShader()
+        .build();
+    auto buffer = GLUniformBuffer("TestBlock");
+
+    SECTION("Returns false if program does not declare block") {
+        auto other = GLUniformBuffer("MissingBlock");
+        CHECK_FALSE(other.attachProgram(program->getID()));
+        CHECK(other.getID() == 0);
+    }
+
+    SECTION("Fails once binding points are exhausted") {
+        auto& logger = Logger::get();
+        auto other = GLUniformBuffer("TestBlock");
+        GLuint bindingPoint = other.bindingPoint;
+        other.bindingPoint = GLUniformBuffer::getBindingPointCount();
+
+        CHECK_FALSE(other.attachProgram(program->getID()));
+        CHECK(logger.getLastLevel() == LogLevel::ERROR);
+        other.bindingPoint = bindingPoint;
+    }
+
+    SECTION("Loads std140 layout from program") {
+        REQUIRE(buffer.attachProgram(program->getID()));
+        CHECK(buffer.getID() != 0);
+        CHECK(buffer.getBlockSize() == 128);
+
+        auto position = buffer.getMember("blockPosition");
+        REQUIRE(position.has_value());
+        CHECK(position->offset == 0);
+        CHECK(position->type == GL_FLOAT_VEC3);
+
+        CHECK(buffer.getMember("blockScale")->offset == 12);
+        CHECK(buffer.getMember("blockTransform")->offset == 16);
+        CHECK(buffer.getMember("blockTransform")->matrixStride == 16);
+        CHECK(buffer.getMember("blockValues")->offset == 80);
+        CHECK(buffer.getMember("blockValues")->arrayStride == 16);
+        CHECK(buffer.getMember("blockValues")->arraySize == 3);
+    }
+
+    SECTION("Binds block to buffer binding point") {
+        REQUIRE(buffer.attachProgram(program->getID()));
+
+        GLuint blockIndex = glGetProgramResourceIndex(
+            program->getID(), GL_UNIFORM_BLOCK, "TestBlock");
+        const GLenum property = GL_BUFFER_BINDING;
+        GLint binding = -1;
+        glGetProgramResourceiv(program->getID(), GL_UNIFORM_BLOCK,
+            blockIndex, 1, &property, 1, nullptr, &binding);
+
+        CHECK(binding == static_cast<GLint>(buffer.getBindingPoint()));
+    }
+}
+
+TEST_CASE("OpenGL_GLUniformBuffer_setUniform") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(blockFragmentPath)
+        .withDefaultVertexShader()
+        .build();
+    auto buffer = GLUniformBuffer("TestBlock");
+    REQUIRE(buffer.attachProgram(program->getID()));
+    buffer.commit();
+
+    SECTION("Ignores uniforms not in block") {
+        CHECK_FALSE(buffer.setUniform(
+            std::make_shared<GLUniformScalar<float>>(1.f, "myFloat1")));
+        CHECK_FALSE(buffer.isDirty);
+    }
+
+    SECTION("Packs arrays using block array stride") {
+        CHECK(buffer.setUniform(std::make_shared<GLUniformVector<float>>(
+            std::vector<float>({ 1.f, 2.f, 3.f }), "blockValues", 1)));
+        CHECK(buffer.isDirty);
+
+        float* data = reinterpret_cast<float*>(buffer.staging.data());
+        CHECK(data[20] == 1.f);
+        CHECK(data[24] == 2.f);
+        CHECK(data[28] == 3.f);
+    }
+
+    SECTION("Does not mark unchanged values as dirty") {
+        buffer.setUniform(
+            std::make_shared<GLUniformScalar<float>>(2.f, "blockScale"));
+        buffer.commit();
+
+        buffer.setUniform(
+            std::make_shared<GLUniformScalar<float>>(2.f, "blockScale"));
+        CHECK_FALSE(buffer.isDirty);
+    }
+
+    SECTION("Writes committed values to bound buffer range") {
+        buffer.setUniform(
+            std::make_shared<GLUniformScalar<float>>(2.f, "blockScale"));
+        buffer.commit();
+
+        GLint64 offset = -1;
+        glGetInteger64i_v(GL_UNIFORM_BUFFER_START,
+            buffer.getBindingPoint(), &offset);
+        REQUIRE(offset >= 0);
+
+        float value = 0.f;
+        glGetNamedBufferSubData(buffer.getID(),
+            offset + 12, sizeof(float), &value);
+        CHECK(value == 2.f);
+    }
+}
+
+TEST_CASE("OpenGL_GLUniformBuffer_GLShaderProgram") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(blockFragmentPath)
+        .withDefaultVertexShader()
+        .build();
+
+    SECTION("Routes block members of model to shared buffer") {
+        auto model = ShaderUniformModel();
+        model.setUniformBlock("TestBlock");
+        model.addUniform(2.f, "blockScale");
+        model.addUniform(1.f, "myFloat1");
+
+        program->receiveData(DataMessage(model));
+
+        REQUIRE(program->uniformBuffers.contains("TestBlock"));
+        auto buffer = program->uniformBuffers.at("TestBlock");
+        CHECK(buffer == GLUniformBuffer::forBlock("TestBlock"));
+        CHECK(buffer->values.contains("blockScale"));
+        CHECK_FALSE(buffer->values.contains("myFloat1"));
+        CHECK(program->uniformManager.uniformCache.contains("myFloat1"));
+    }
+}
@@ -0,0 +1,155 @@
+#include <catch.hpp>
+
+#include <cstring>
+
+#include "Data/ShaderUniformModel.hpp"
+#include "OpenGL/GLShaderProgram.hpp"
+#include "OpenGL/GLUniformStorage.hpp"
+
+#include "OpenGL/GLTestUtils.hpp"
+
+using basil::DataMessage;
+using basil::GLShaderProgram;
+using basil::GLUniformStorage;
+using basil::Logger;
+using basil::LogLevel;
+using basil::ShaderUniformModel;
+
+inline std::filesystem::path storageFragmentPath =
+    std::filesystem::path(TEST_DIR) / "OpenGL/assets/test-storage.frag";
+
+TEST_CASE("OpenGL_GLUniformStorage_updateRange") {
+    std::vector<float> values = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+    auto storage = GLUniformStorage(values, "TestStorage");
+    storage.needsAllocation = false;
+    storage.dirtyBegin = storage.dirtyEnd = 0;
+
+    SECTION("Copies values on construction") {
+        CHECK(storage.getName() == "TestStorage");
+        CHECK(storage.getCount() == 6);
+        CHECK(storage.getStorageSize() == 6 * sizeof(float));
+        CHECK(std::memcmp(storage.getStorageData(), values.data(),
+            storage.getStorageSize()) == 0);
+    }
+
+    SECTION("Overwrites range of elements") {
+        std::vector<float> update = { 8.f, 9.f };
+        CHECK(storage.updateRange(std::span<const float>(update), 2));
+
+        auto data = reinterpret_cast<const float*>(storage.getStorageData());
+        CHECK(data[1] == 2.f);
+        CHECK(data[2] == 8.f);
+        CHECK(data[3] == 9.f);
+        CHECK(data[4] == 5.f);
+
+        CHECK(storage.hasPendingUpload());
+        CHECK(storage.dirtyBegin == 2 * sizeof(float));
+        CHECK(storage.dirtyEnd == 4 * sizeof(float));
+        CHECK_FALSE(storage.needsAllocation);
+    }
+
+    SECTION("Merges consecutive updates into one range") {
+        std::vector<float> update = { 0.f };
+        storage.updateRange(std::span<const float>(update), 4);
+        storage.updateRange(std::span<const float>(update), 1);
+
+        CHECK(storage.dirtyBegin == 1 * sizeof(float));
+        CHECK(storage.dirtyEnd == 5 * sizeof(float));
+    }
+
+    SECTION("Rejects ranges outside of data") {
+        std::vector<float> update = { 0.f, 0.f };
+        CHECK_FALSE(storage.updateRange(std::span<const float>(update), 5));
+        CHECK_FALSE(storage.updateRange(std::span<const float>(update), 7));
+        CHECK_FALSE(storage.hasPendingUpload());
+    }
+
+    SECTION("Reallocates only if size changes") {
+        std::vector<float> sameSize(6, 0.f);
+        storage.setValues(std::span<const float>(sameSize));
+        CHECK_FALSE(storage.needsAllocation);
+        CHECK(storage.hasPendingUpload());
+
+        std::vector<float> larger(12, 0.f);
+        storage.setValues(std::span<const float>(larger));
+        CHECK(storage.needsAllocation);
+        CHECK(storage.getCount() == 12);
+    }
+}
+
+TEST_CASE("OpenGL_GLUniformStorage_upload") { BASIL_LOCK_TEST
+    std::vector<float> values = { 1.f, 2.f, 3.f, 4.f };
+    auto storage = GLUniformStorage(values, "TestStorage");
+
+    SECTION("Creates buffer containing data") {
+        GLuint bufferID = storage.upload();
+        REQUIRE(bufferID != 0);
+        CHECK(storage.getBufferID() == bufferID);
+        CHECK_FALSE(storage.hasPendingUpload());
+
+        std::vector<float> result(4, 0.f);
+        glGetNamedBufferSubData(bufferID, 0,
+            result.size() * sizeof(float), result.data());
+        CHECK(result == values);
+    }
+
+    SECTION("Copies updated range into existing buffer") {
+        GLuint bufferID = storage.upload();
+
+        std::vector<float> update = { 7.f };
+        storage.updateRange(std::span<const float>(update), 3);
+        CHECK(storage.upload() == bufferID);
+
+        float value = 0.f;
+        glGetNamedBufferSubData(bufferID,
+            3 * sizeof(float), sizeof(float), &value);
+        CHECK(value == 7.f);
+    }
+}
+
+TEST_CASE("OpenGL_GLUniformStorage_GLShaderProgram") { BASIL_LOCK_TEST
+    auto program = GLShaderProgram::Builder()
+        .withFragmentShaderFromFile(storageFragmentPath)
+        .withDefaultVertexShader()
+        .build();
+    auto& manager = program->uniformManager;
+
+    SECTION("Assigns distinct binding points to storage blocks") {
+        auto testBinding = manager.getStorageBlockBinding("TestStorage");
+        auto otherBinding = manager.getStorageBlockBinding("OtherStorage");
+        REQUIRE(testBinding.has_value());
+        REQUIRE(otherBinding.has_value());
+        CHECK(testBinding != otherBinding);
+
+        CHECK_FALSE(manager.getStorageBlockBinding("Missing").has_value());
+    }
+
+    SECTION("Binds storage buffer of model on use") {
+        auto model = ShaderUniformModel();
+        model.addStorageBuffer(std::vector<float>(8, 1.f), "TestStorage");
+        program->receiveData(DataMessage(model));
+
+        auto storage = std::dynamic_pointer_cast<GLUniformStorage>(
+            model.getUniform("TestStorage").value());
+        CHECK(storage->getBufferID() == 0);
+
+        program->use();
+        REQUIRE(storage->getBufferID() != 0);
+
+        GLint boundBuffer = 0;
+        glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING,
+            manager.getStorageBlockBinding("TestStorage").value(),
+            &boundBuffer);
+        CHECK(boundBuffer == static_cast<GLint>(storage->getBufferID()));
+    }
+
+    SECTION("Logs missing storage blocks once") {
+        Logger& logger = Logger::get();
+        logger.clearTestInfo();
+
+        manager.setUniform(std::make_shared<GLUniformStorage>(
+            std::vector<float>(4, 0.f), "MissingStorage"));
+        CHECK(logger.getLastLevel() == LogLevel::DEBUG);
+        CHECK(manager.storageBindings.empty());
+    }
+}
@@ -1,6 +1,7 @@
 #include <catch.hpp>
 
 #include "OpenGL/HotReloadShaderPane.hpp"
+#include "Process/EventMetrics.hpp"
 
 #include "OpenGL/GLTestUtils.hpp"
 #include "Window/WindowTestUtils.hpp"
@@ -38,13 +39,65 @@ TEST_CASE("OpenGL_HotReloadShaderPane_draw") { BASIL_LOCK_TEST
         CHECK(pane.currentShaderProgram->getFragmentShader()
             == pane.defaultFrag);
 
-        pane.timestamp = std::filesystem::file_time_type::min();
         pane.filePath = fragmentPath;
-        pane.draw();
+        pane.fileWatches = {
+            basil::FileWatchService::get().watch(fragmentPath)
+        };
+        for (int frame = 0; frame < 1000; frame++) {
+            pane.draw();
+            if (!pane.pendingProgram) break;
+        }
 
         CHECK(pane.currentShaderProgram->getFragmentShader()
             != pane.defaultFrag);
     }
+
+    SECTION("Draws previous program until modified shader has linked") {
+        auto previous = pane.currentShaderProgram;
+        previous->setUniform(
+            std::make_shared<basil::GLUniformScalar<float>>(1.f, "myFloat1"));
+
+        pane.filePath = fragmentPath;
+        pane.compilePendingProgram();
+        CHECK(pane.currentShaderProgram == previous);
+
+        pane.applyPendingProgram();
+        CHECK(pane.currentShaderProgram != previous);
+        CHECK(pane.currentShaderProgram->uniformManager
+            .getCachedUniforms().contains("myFloat1"));
+        CHECK_FALSE(pane.pendingProgram);
+    }
+
+    SECTION("Records compile duration as event") {
+        basil::EventMetrics::get().flush();
+
+        pane.filePath = fragmentPath;
+        pane.compilePendingProgram();
+        pane.applyPendingProgram();
+
+        auto events = basil::EventMetrics::get().flush();
+        CHECK(events.contains("Compile test.frag"));
+    }
+
+    SECTION("Watches includes of shader") {
+        pane.filePath = std::filesystem::path(TEST_DIR)
+            / "OpenGL/assets/test-include.frag";
+        pane.compilePendingProgram();
+
+        REQUIRE(pane.fileWatches.size() == 2);
+        CHECK(pane.fileWatches.back()->getPath().filename()
+            == "common.glsl");
+        CHECK_FALSE(pane.fileWatches.back()->hasChanged());
+    }
+
+    SECTION("Uses debug shader if modified shader fails") {
+        pane.filePath = badFragmentPath;
+        pane.compilePendingProgram();
+        pane.applyPendingProgram();
+
+        CHECK(pane.currentShaderProgram->getFragmentShader()
+            == pane.defaultFrag);
+    }
 }
 
 TEST_CASE("OpenGL_HotReloadShaderPane_Builder") { BASIL_LOCK_TEST
@@ -0,0 +1,2 @@
+#pragma once
+vec4 commonColor() { return vec4(1.0); }
@@ -0,0 +1 @@
+#include "recursive.glsl"
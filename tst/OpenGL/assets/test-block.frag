@@ -0,0 +1,18 @@
+#version 450 core
+
+layout(std140) uniform TestBlock {
+    vec3    blockPosition;
+    float   blockScale;
+    mat4    blockTransform;
+    float   blockValues[3];
+};
+
+uniform float myFloat1;
+
+out vec4 FragColor;
+
+void main()
+{
+    float testVal = blockScale + blockTransform[3][3] + blockValues[2];
+    FragColor = vec4(blockPosition * testVal * myFloat1, 1.0);
+}
@@ -0,0 +1,2 @@
+#version 450 core
+#include "include/recursive.glsl"
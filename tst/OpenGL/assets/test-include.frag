@@ -0,0 +1,5 @@
+#version 450 core
+#include "include/common.glsl"
+#include "include/common.glsl"
+out vec4 FragColor;
+void main() { FragColor = commonColor(); }
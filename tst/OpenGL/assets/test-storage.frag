@@ -0,0 +1,16 @@
+#version 450 core
+
+layout(std430) readonly buffer TestStorage {
+    vec4    storageValues[];
+};
+
+layout(std430) readonly buffer OtherStorage {
+    float   otherValues[];
+};
+
+out vec4 FragColor;
+
+void main()
+{
+    FragColor = storageValues[1] * otherValues[0];
+}
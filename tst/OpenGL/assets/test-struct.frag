@@ -0,0 +1,16 @@
+#version 450 core
+
+struct Light {
+    vec3    color;
+    float   values[2];
+};
+
+uniform Light lights[2];
+
+out vec4 FragColor;
+
+void main()
+{
+    float testVal = lights[0].values[1] + lights[1].values[1];
+    FragColor = vec4((lights[0].color + lights[1].color) * testVal, 1.0);
+}
@@ -28,6 +28,8 @@ uniform mat3x3 myFloat3x3;
 uniform mat3x4 myFloat3x4;
 uniform mat4x4 myFloat4x4;
 
+uniform float myFloatArray[4];
+
 uniform sampler2D testTex;
 
 out vec4 FragColor;
@@ -40,6 +42,7 @@ void main()
         = myFloat2x2[0][0] + myFloat2x3[0][0] + myFloat2x4[0][0] +
           myFloat3x3[0][0] + myFloat3x4[0][0] + myFloat4x4[0][0];
     testVal += (myBool1   ? myInt1 : int(myUnsignedInt1))   * myFloat1;
+    testVal += myFloatArray[0] + myFloatArray[3];
     vec2 testVal2 = (myBool2.y ? myInt2 : ivec2(myUnsignedInt2)) * myFloat2;
     vec3 testVal3 = (myBool3.z ? myInt3 : ivec3(myUnsignedInt3)) * myFloat3;
     vec4 testVal4 = (myBool4.w ? myInt4 : ivec4(myUnsignedInt4)) * myFloat4;
@@ -0,0 +1,45 @@
+#include <catch.hpp>
+
+#include "Process/EventMetrics.hpp"
+
+using basil::EventMetric;
+using basil::EventMetrics;
+
+TEST_CASE("Process_EventMetrics_recordEvent") {
+    EventMetrics& metrics = EventMetrics::get();
+    metrics.flush();
+
+    auto duration = std::chrono::milliseconds(5);
+
+    SECTION("Accumulates events by name") {
+        metrics.recordEvent("first", duration);
+        metrics.recordEvent("first", duration);
+        metrics.recordEvent("second", duration);
+
+        auto result = metrics.flush();
+        REQUIRE(result.size() == 2);
+
+        CHECK(result.at("first").eventCount == 2);
+        CHECK(result.at("first").totalTime == 2 * duration);
+        CHECK(result.at("second").eventCount == 1);
+    }
+
+    SECTION("Clears events on flush") {
+        metrics.recordEvent("first", duration);
+
+        CHECK(metrics.flush().size() == 1);
+        CHECK(metrics.flush().empty());
+    }
+}
+
+TEST_CASE("Process_EventMetrics_EventMetric") {
+    auto ms = [](int count) { return std::chrono::milliseconds(count); };
+
+    SECTION("Adds and subtracts counts and durations") {
+        EventMetric first = { 3, ms(30) };
+        EventMetric second = { 1, ms(10) };
+
+        CHECK(first + second == EventMetric { 4, ms(40) });
+        CHECK(first - second == EventMetric { 2, ms(20) });
+    }
+}
@@ -0,0 +1,52 @@
+#include <catch.hpp>
+
+#include "Process/GLCallMetrics.hpp"
+
+using basil::GLCallMetric;
+using basil::GLCallMetrics;
+using basil::GLCallType;
+
+TEST_CASE("Process_GLCallMetrics_recordCall") {
+    GLCallMetrics& metrics = GLCallMetrics::get();
+    metrics.flush();
+
+    SECTION("Accumulates calls and bytes by category") {
+        metrics.recordCall(GLCallType::DRAW);
+        metrics.recordCall(GLCallType::DRAW);
+        metrics.recordCall(GLCallType::TEXTURE_UPLOAD, 64);
+        metrics.recordCall(GLCallType::TEXTURE_UPLOAD, 32);
+
+        auto result = metrics.flush();
+        REQUIRE(result.size() == 2);
+
+        CHECK(result.at(GLCallType::DRAW) == GLCallMetric { 2, 0 });
+        CHECK(result.at(GLCallType::TEXTURE_UPLOAD)
+            == GLCallMetric { 2, 96 });
+    }
+
+    SECTION("Clears calls on flush") {
+        metrics.recordCall(GLCallType::BIND);
+
+        CHECK(metrics.flush().size() == 1);
+        CHECK(metrics.flush().empty());
+    }
+}
+
+TEST_CASE("Process_GLCallMetrics_getTypeName") {
+    SECTION("Names each category") {
+        CHECK(GLCallMetrics::getTypeName(GLCallType::UNIFORM) == "uniform");
+        CHECK(GLCallMetrics::getTypeName(GLCallType::READBACK)
+            == "readback");
+    }
+}
+
+TEST_CASE("Process_GLCallMetrics_GLCallMetric") {
+    SECTION("Adds, subtracts and divides counts and bytes") {
+        GLCallMetric first = { 6, 60 };
+        GLCallMetric second = { 2, 20 };
+
+        CHECK(first + second == GLCallMetric { 8, 80 });
+        CHECK(first - second == GLCallMetric { 4, 40 });
+        CHECK(first / 2 == GLCallMetric { 3, 30 });
+    }
+}
@@ -79,6 +79,59 @@ TEST_CASE("Process_MetricsObserver_recordFrameEnd") {
     }
 }
 
+TEST_CASE("Process_MetricsObserver_recordFrameEnd_messageMetrics") {
+    MetricsObserver metrics = MetricsObserver();
+    basil::PubSubMetrics& pubSubMetrics = basil::PubSubMetrics::get();
+    pubSubMetrics.flush();
+
+    int publisher = 0;
+    pubSubMetrics.recordPublish(&publisher, "publisher",
+        typeid(float), 1, sizeof(float), std::chrono::milliseconds(1));
+
+    auto start = FrameClock::now();
+    metrics.recordFrameStart(start);
+    metrics.recordFrameEnd(start);
+
+    SECTION("Collects PubSub metrics into record") {
+        CHECK(metrics.current.messageMetrics.size() == 1);
+        CHECK(pubSubMetrics.flush().empty());
+    }
+}
+
+TEST_CASE("Process_MetricsObserver_recordFrameEnd_eventMetrics") {
+    MetricsObserver metrics = MetricsObserver();
+    basil::EventMetrics& eventMetrics = basil::EventMetrics::get();
+    eventMetrics.flush();
+
+    eventMetrics.recordEvent("event", std::chrono::milliseconds(1));
+
+    auto start = FrameClock::now();
+    metrics.recordFrameStart(start);
+    metrics.recordFrameEnd(start);
+
+    SECTION("Collects events into record") {
+        CHECK(metrics.current.eventMetrics.size() == 1);
+        CHECK(eventMetrics.flush().empty());
+    }
+}
+
+TEST_CASE("Process_MetricsObserver_recordFrameEnd_glCallMetrics") {
+    MetricsObserver metrics = MetricsObserver();
+    basil::GLCallMetrics& glCallMetrics = basil::GLCallMetrics::get();
+    glCallMetrics.flush();
+
+    glCallMetrics.recordCall(basil::GLCallType::DRAW);
+
+    auto start = FrameClock::now();
+    metrics.recordFrameStart(start);
+    metrics.recordFrameEnd(start);
+
+    SECTION("Collects GL calls into record") {
+        CHECK(metrics.current.glCallMetrics.size() == 1);
+        CHECK(glCallMetrics.flush().empty());
+    }
+}
+
 TEST_CASE("Process_MetricsObserver_getCurrentMetrics") {
     MetricsObserver metrics = MetricsObserver();
 
@@ -66,6 +66,56 @@ TEST_CASE("Process_MetricsRecord_operator") {
         CHECK(result.processTimes[instance2]  == ms(4));
     }
 
+    SECTION("Operators combine message metrics") {
+        basil::MessageMetricsKey key = { "publisher", "float" };
+        firstRecord.messageMetrics[key] = { 4, 8, 16, ms(20) };
+        secondRecord.messageMetrics[key] = { 2, 4, 8, ms(10) };
+
+        MetricsRecord sum = firstRecord + secondRecord;
+        CHECK(sum.messageMetrics[key].messageCount == 6);
+        CHECK(sum.messageMetrics[key].receiveTime == ms(30));
+
+        MetricsRecord average = sum / 2;
+        CHECK(average.messageMetrics[key].deliveryCount == 6);
+
+        MetricsRecord difference = average - secondRecord;
+        CHECK(difference.messageMetrics[key].bytesDelivered == 4);
+    }
+
+    SECTION("Operators total event metrics") {
+        firstRecord.eventMetrics["compile"] = { 1, ms(200) };
+        secondRecord.eventMetrics["compile"] = { 1, ms(100) };
+
+        MetricsRecord sum = firstRecord + secondRecord;
+        CHECK(sum.eventMetrics["compile"].eventCount == 2);
+        CHECK(sum.eventMetrics["compile"].totalTime == ms(300));
+
+        MetricsRecord average = sum / 2;
+        CHECK(average.eventMetrics["compile"].eventCount == 2);
+
+        MetricsRecord difference = average - secondRecord;
+        CHECK(difference.eventMetrics["compile"].totalTime == ms(200));
+
+        MetricsRecord oldest = MetricsRecord();
+        oldest.eventMetrics["compile"] = { 1, ms(200) };
+        CHECK_FALSE((difference - oldest).eventMetrics.contains("compile"));
+    }
+
+    SECTION("Operators average GL call metrics") {
+        using basil::GLCallType;
+        firstRecord.glCallMetrics[GLCallType::DRAW] = { 6, 0 };
+        secondRecord.glCallMetrics[GLCallType::DRAW] = { 2, 0 };
+
+        MetricsRecord sum = firstRecord + secondRecord;
+        CHECK(sum.glCallMetrics[GLCallType::DRAW].callCount == 8);
+
+        MetricsRecord average = sum / 2;
+        CHECK(average.glCallMetrics[GLCallType::DRAW].callCount == 4);
+
+        MetricsRecord difference = average - secondRecord;
+        CHECK(difference.glCallMetrics[GLCallType::DRAW].callCount == 2);
+    }
+
     SECTION("operator== and operator!=") {
         MetricsRecord equalRecord = firstRecord;
 
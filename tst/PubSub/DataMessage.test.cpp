@@ -31,3 +31,28 @@ TEST_CASE("PubSub_DataMessage_getData") {
         REQUIRE_FALSE(result.has_value());
     }
 }
+
+TEST_CASE("PubSub_DataMessage_getDataPointer") {
+    const std::string data = "data";
+    DataMessage message = DataMessage(data);
+
+    SECTION("Returns pointer if castable to type") {
+        auto result = message.getDataPointer<std::string>();
+
+        REQUIRE(result != nullptr);
+        CHECK(*result == data);
+    }
+
+    SECTION("Returns contents of shared pointer") {
+        std::shared_ptr<std::string> ptrData =
+            std::make_shared<std::string>(data);
+        message = DataMessage(ptrData);
+        auto result = message.getDataPointer<std::string>();
+
+        CHECK(result == ptrData.get());
+    }
+
+    SECTION("Returns nullptr if payload cannot be cast to type") {
+        CHECK(message.getDataPointer<float>() == nullptr);
+    }
+}
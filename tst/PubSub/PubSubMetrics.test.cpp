@@ -0,0 +1,89 @@
+#include <catch.hpp>
+
+#include "PubSub/PubSubMetrics.hpp"
+
+#include "PubSub/PubSubTestUtils.hpp"
+
+using basil::DataMessage;
+using basil::MessageMetrics;
+using basil::MessageMetricsKey;
+using basil::PubSubMetrics;
+using basil::TestPublisher;
+using basil::TestSubscriber;
+
+TEST_CASE("PubSub_PubSubMetrics_recordPublish") {
+    PubSubMetrics& metrics = PubSubMetrics::get();
+    metrics.flush();
+
+    int publisher = 0;
+    auto duration = std::chrono::milliseconds(2);
+
+    SECTION("Accumulates counters by publisher and type") {
+        metrics.recordPublish(&publisher, "publisher",
+            typeid(float), 2, sizeof(float), duration);
+        metrics.recordPublish(&publisher, "publisher",
+            typeid(float), 3, sizeof(float), duration);
+        metrics.recordPublish(&publisher, "publisher",
+            typeid(int), 1, sizeof(int), duration);
+
+        auto result = metrics.flush();
+        REQUIRE(result.size() == 2);
+
+        MessageMetrics floatMetrics =
+            result.at(MessageMetricsKey("publisher", "float"));
+        CHECK(floatMetrics.messageCount == 2);
+        CHECK(floatMetrics.deliveryCount == 5);
+        CHECK(floatMetrics.bytesDelivered == 5 * sizeof(float));
+        CHECK(floatMetrics.receiveTime == 2 * duration);
+    }
+
+    SECTION("Clears counters on flush") {
+        metrics.recordPublish(&publisher, "publisher",
+            typeid(float), 1, sizeof(float), duration);
+
+        CHECK(metrics.flush().size() == 1);
+        CHECK(metrics.flush().size() == 0);
+    }
+}
+
+TEST_CASE("PubSub_PubSubMetrics_publishData") {
+    PubSubMetrics& metrics = PubSubMetrics::get();
+    metrics.flush();
+
+    auto publisher = TestPublisher();
+    auto subscriber = std::make_shared<TestSubscriber>();
+    publisher.subscribe(subscriber);
+
+    SECTION("Does not record while disabled") {
+        metrics.setEnabled(false);
+        publisher.publishData(DataMessage(1.5f));
+
+        CHECK(subscriber->hasReceivedData);
+        CHECK(metrics.flush().empty());
+    }
+
+    SECTION("Records publisher while enabled") {
+        metrics.setEnabled(true);
+        publisher.publishData(DataMessage(1.5f));
+        metrics.setEnabled(false);
+
+        auto result = metrics.flush();
+        REQUIRE(result.size() == 1);
+        CHECK(result.begin()->first.first ==
+            publisher.getPublisherName());
+        CHECK(result.begin()->second.deliveryCount == 1);
+        CHECK(result.begin()->second.bytesDelivered == sizeof(float));
+    }
+}
+
+TEST_CASE("PubSub_PubSubMetrics_MessageMetrics") {
+    MessageMetrics first = { 4, 8, 16, std::chrono::milliseconds(20) };
+    MessageMetrics second = { 2, 4, 8, std::chrono::milliseconds(10) };
+
+    SECTION("Supports averaging operators") {
+        CHECK(first + second ==
+            MessageMetrics { 6, 12, 24, std::chrono::milliseconds(30) });
+        CHECK(first - second == second);
+        CHECK(first / 2 == second);
+    }
+}
@@ -60,6 +60,20 @@ TEST_CASE("Widget_MetricsReporter_onLoop") {
         reporter.onLoop();
         CHECK_FALSE(logger.getLastOutput() == "");
     }
+
+    SECTION("Logs message metrics") {
+        record.frameID = 10;
+        record.messageMetrics[{ "publisher", "float" }] =
+            { 1, 2, 8, std::chrono::milliseconds(1) };
+        observer.buffer.emplace(record);
+        observer.sum = record;
+
+        logger.clearTestInfo();
+        reporter.onLoop();
+        CHECK(logger.getLastOutput() ==
+            "Messages 'publisher' <float>: 1 sent, 2 delivered, "
+            "8 bytes, 1.000ms");
+    }
 }
 
 TEST_CASE("Widget_MetricsReporter_Builder") {
@@ -72,4 +86,14 @@ TEST_CASE("Widget_MetricsReporter_Builder") {
         CHECK(reporter->regularity == 25);
         CHECK(reporter->logLevel == LogLevel::DEBUG);
     }
+
+    SECTION("Enables message metrics") {
+        auto reporter = MetricsReporter::Builder()
+            .withMessageMetrics()
+            .build();
+
+        CHECK(basil::PubSubMetrics::get().isEnabled());
+        reporter->setMessageMetricsEnabled(false);
+        CHECK_FALSE(basil::PubSubMetrics::get().isEnabled());
+    }
 }
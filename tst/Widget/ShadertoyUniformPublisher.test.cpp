@@ -49,11 +49,37 @@ TEST_CASE("Widget_ShadertoyUniformPublisher_onLoop") {
             == UserInputWatcher::TEST_MOUSE_Y_POSITION);
     }
 
+    SECTION("Updates uniforms in place") {
+        widget.onStart();
+        const std::byte* packedData = widget.getModel().uniformData.data();
+        std::size_t packedSize = widget.getModel().uniformData.size();
+        widget.onLoop();
+
+        CHECK(widget.getModel().uniformData.data() == packedData);
+        CHECK(widget.getModel().uniformData.size() == packedSize);
+    }
+
     SECTION("Publishes data") {
         CHECK_FALSE(subscriber->hasReceivedData);
         widget.onLoop();
         CHECK(subscriber->hasReceivedData);
     }
+
+    SECTION("Publishes only uniforms changed since last loop") {
+        widget.onStart();
+        widget.onLoop();
+        CHECK(widget.publishedVersion == widget.getModel().getVersion());
+
+        uint64_t version = widget.publishedVersion;
+        widget.onLoop();
+
+        auto delta = widget.getModel().getDelta(version);
+        CHECK_FALSE(delta.isComplete());
+        for (const auto& uniform : delta.uniforms) {
+            CHECK(uniform->getName() != "iResolution");
+            CHECK(uniform->getName() != "iMouse");
+        }
+    }
 }
 
 TEST_CASE("Widget_ShadertoyUniformPublisher_setFocusPane") {